@@ -7,6 +7,11 @@ static void rb_batch_free(void* ptr) {
         cass_batch_free(wrapper->batch);
     }
     xfree(wrapper);
+    native_handle_freed(NATIVE_BATCHES);
+}
+
+static size_t rb_batch_memsize(const void* ptr) {
+    return sizeof(BatchWrapper);
 }
 
 // Define the Ruby data type for Batch
@@ -15,7 +20,7 @@ const rb_data_type_t batch_type = {
     .function = {
         .dmark = NULL,
         .dfree = rb_batch_free,
-        .dsize = NULL,
+        .dsize = rb_batch_memsize,
     },
     .data = NULL,
     .flags = RUBY_TYPED_FREE_IMMEDIATELY
@@ -25,7 +30,10 @@ const rb_data_type_t batch_type = {
 VALUE batch_new(CassBatch* batch) {
     BatchWrapper* wrapper = ALLOC(BatchWrapper);
     wrapper->batch = batch;
+    wrapper->request_timeout_ms = CASS_UINT64_MAX;
+    wrapper->deadline_timeout = 0;
     VALUE rb_batch = TypedData_Wrap_Struct(cCassBatch, &batch_type, wrapper);
+    native_handle_created(NATIVE_BATCHES);
     return rb_batch;
 }
 
@@ -33,7 +41,11 @@ VALUE batch_new(CassBatch* batch) {
 static VALUE rb_batch_allocate(VALUE klass) {
     BatchWrapper* wrapper = ALLOC(BatchWrapper);
     wrapper->batch = NULL; // Will be set in initialize
-    return TypedData_Wrap_Struct(klass, &batch_type, wrapper);
+    wrapper->request_timeout_ms = CASS_UINT64_MAX;
+    wrapper->deadline_timeout = 0;
+    VALUE rb_batch = TypedData_Wrap_Struct(klass, &batch_type, wrapper);
+    native_handle_created(NATIVE_BATCHES);
+    return rb_batch;
 }
 
 // Initialize method for Batch
@@ -77,10 +89,24 @@ static VALUE rb_batch_initialize(int argc, VALUE* argv, VALUE self) {
     if (!wrapper->batch) {
         rb_raise(rb_eCassandraError, "Failed to create batch");
     }
+    wrapper->request_timeout_ms = CASS_UINT64_MAX;
+    wrapper->deadline_timeout = 0;
 
     return self;
 }
 
+// Like statement_apply_deadline; without a deadline the batch goes back to the
+// timeout given to request_timeout=
+void batch_apply_deadline(BatchWrapper* wrapper, cass_int64_t deadline_us, cass_uint64_t timeout_ms) {
+    if (deadline_us != FUTURE_WAIT_FOREVER) {
+        cass_batch_set_request_timeout(wrapper->batch, timeout_ms);
+        wrapper->deadline_timeout = 1;
+    } else if (wrapper->deadline_timeout) {
+        cass_batch_set_request_timeout(wrapper->batch, wrapper->request_timeout_ms);
+        wrapper->deadline_timeout = 0;
+    }
+}
+
 // Set consistency for this batch
 static VALUE rb_batch_set_consistency(VALUE self, VALUE consistency) {
     BatchWrapper* wrapper;
@@ -137,6 +163,8 @@ static VALUE rb_batch_set_request_timeout(VALUE self, VALUE timeout_ms) {
     if (error != CASS_OK) {
         rb_raise(rb_eCassandraError, "Failed to set batch request timeout: %s", cass_error_desc(error));
     }
+    wrapper->request_timeout_ms = timeout_value;
+    wrapper->deadline_timeout = 0;
 
     return self;
 }
@@ -165,12 +193,7 @@ static VALUE rb_batch_add_statement(VALUE self, VALUE statement) {
         rb_raise(rb_eCassandraError, "Batch is NULL");
     }
 
-    StatementWrapper* statement_wrapper;
-    TypedData_Get_Struct(statement, StatementWrapper, &statement_type, statement_wrapper);
-
-    if (statement_wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* statement_wrapper = statement_get(statement);
 
     CassError error = cass_batch_add_statement(wrapper->batch, statement_wrapper->statement);
     if (error != CASS_OK) {
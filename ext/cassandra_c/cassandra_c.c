@@ -1,4 +1,5 @@
 #include "cassandra_c.h"
+#include "ruby/atomic.h"
 
 /*
  * CassandraC Ruby Extension - Main Module
@@ -60,6 +61,47 @@ CassConsistency ruby_value_to_consistency(VALUE consistency) {
     }
 }
 
+// ============================================================================
+// Native Memory Accounting
+// ============================================================================
+
+// Updated from any Ractor, and from free functions during GC
+static rb_atomic_t live_handles[NATIVE_HANDLE_KINDS];
+static size_t result_bytes;
+
+void native_handle_created(NativeHandleKind kind) {
+    RUBY_ATOMIC_INC(live_handles[kind]);
+}
+
+void native_handle_freed(NativeHandleKind kind) {
+    RUBY_ATOMIC_DEC(live_handles[kind]);
+}
+
+// Report driver-owned memory to the GC so large results count towards its
+// malloc limit. Negative adjustments never trigger a collection, so this is
+// safe from free functions.
+void native_memory_adjust(ssize_t diff) {
+    if (diff > 0) {
+        RUBY_ATOMIC_SIZE_ADD(result_bytes, (size_t)diff);
+    } else if (diff < 0) {
+        RUBY_ATOMIC_SIZE_SUB(result_bytes, (size_t)-diff);
+    }
+    rb_gc_adjust_memory_usage(diff);
+}
+
+// Live handle counts and the row data bytes held by live results.
+// Futures count until they are released, cancelled or collected.
+static VALUE native_stats(VALUE self) {
+    VALUE stats = rb_hash_new();
+    rb_hash_aset(stats, ID2SYM(rb_intern("statements")), UINT2NUM((unsigned int)live_handles[NATIVE_STATEMENTS]));
+    rb_hash_aset(stats, ID2SYM(rb_intern("futures")), UINT2NUM((unsigned int)live_handles[NATIVE_FUTURES]));
+    rb_hash_aset(stats, ID2SYM(rb_intern("results")), UINT2NUM((unsigned int)live_handles[NATIVE_RESULTS]));
+    rb_hash_aset(stats, ID2SYM(rb_intern("prepared")), UINT2NUM((unsigned int)live_handles[NATIVE_PREPARED]));
+    rb_hash_aset(stats, ID2SYM(rb_intern("batches")), UINT2NUM((unsigned int)live_handles[NATIVE_BATCHES]));
+    rb_hash_aset(stats, ID2SYM(rb_intern("result_bytes")), SIZET2NUM(result_bytes));
+    return stats;
+}
+
 // ============================================================================
 // Constants Definition
 // ============================================================================
@@ -85,6 +127,9 @@ static void define_consistency_constants(VALUE mCassandraC) {
 // ============================================================================
 
 void Init_cassandra_c(void) {
+    // All global state is immutable after Init or guarded per Ractor
+    rb_ext_ractor_safe(true);
+
     // Create the main CassandraC module
     mCassandraC = rb_define_module("CassandraC");
 
@@ -97,13 +142,18 @@ void Init_cassandra_c(void) {
     // Define module constants
     define_consistency_constants(mCassandraC);
 
+    rb_define_singleton_method(mCassandraCNative, "stats", native_stats, 0);
+
     // Initialize all sub-components under the Native module
+    Init_cassandra_c_value(mCassandraCNative);
     Init_cassandra_c_cluster(mCassandraCNative);
     Init_cassandra_c_session(mCassandraCNative);
     Init_cassandra_c_future(mCassandraCNative);
     Init_cassandra_c_result(mCassandraCNative);
+    Init_cassandra_c_row(mCassandraCNative);
     Init_cassandra_c_prepared(mCassandraCNative);
     Init_cassandra_c_statement(mCassandraCNative);
     Init_cassandra_c_batch(mCassandraCNative);
+    Init_cassandra_c_completion_queue(mCassandraCNative);
     Init_cassandra_c_timeuuid(mCassandraCNative);
 }
@@ -41,28 +41,135 @@ typedef struct {
     CassCluster* cluster;
 } ClusterWrapper;
 
+// In-flight request accounting for a Session (see session.c)
+typedef struct SessionLimiter SessionLimiter;
+
 typedef struct {
     CassSession* session;
+    SessionLimiter* limiter;
 } SessionWrapper;
 
+// Completion notifications for a CassFuture (see future.c). The driver callback
+// can only be registered once per future, so every feature that needs to know
+// when a future completes attaches a listener to a shared FutureCompletion.
+typedef struct FutureCompletion FutureCompletion;
+
+// Listeners run exactly once, usually on a driver IO thread: never call into Ruby
+typedef void (*FutureListenerFn)(void* data);
+
+// What a completed future resolves to
+typedef enum {
+    FUTURE_KIND_EMPTY,     // connect: resolves to nil
+    FUTURE_KIND_RESULT,    // execute / execute_batch: resolves to a Result
+    FUTURE_KIND_PREPARED   // prepare: resolves to a Prepared
+} FutureKind;
+
+// How a chained future (Future#then and friends) settles once its upstream completes
+typedef enum {
+    FUTURE_STAGE_NONE,     // Backed by a driver future from the start
+    FUTURE_STAGE_BIND,     // Bind the upstream's Prepared to a Statement
+    FUTURE_STAGE_EXECUTE,  // Execute the upstream's Statement on a Session
+    FUTURE_STAGE_THEN      // Call a block with the upstream's value
+} FutureStage;
+
 typedef struct {
-    CassFuture* future;
+    CassFuture* future;            // NULL until a chained future's stage starts a request
+    FutureCompletion* completion;  // Created lazily on first use
+    FutureKind kind;
+    VALUE callbacks;               // Pending on_complete/on_success/on_failure blocks
+    int dispatch_pending;          // Callbacks are queued for the dispatcher thread
+    FutureStage stage;
+    VALUE upstream;                // Future this one is chained to; nil once settled
+    VALUE argument;                // Stage argument: bind values, Session or block
+    VALUE value;                   // Value settled without a driver future, or Qundef
+    int settling;                  // A thread is running the stage
+    cass_int64_t deadline_us;      // Request deadline bounding waits, or FUTURE_WAIT_FOREVER
+    int cancelled;                 // Future#cancel was called
+    int released;                  // Future#release was called
+    int counted;                   // Counted as live in Native.stats (until released or cancelled)
+    int waiters;                   // Threads waiting on the driver future
+    VALUE prepared;                // Prepared whose cached metadata the Result adopts, or nil
+    VALUE session;                 // Session and Statement that fetch the Result's
+    VALUE statement;               // following pages, or nil
 } FutureWrapper;
 
+// Intrusive lock-free multi-producer/single-consumer stack. Producers (driver
+// IO threads) push single nodes; the consumer detaches the whole list at once.
+typedef struct MpscNode {
+    struct MpscNode* next;
+} MpscNode;
+
+typedef struct {
+    MpscNode* head;
+} MpscStack;
+
+// Tagged completion queue (see completion_queue.c)
+typedef struct CompletionQueueState CompletionQueueState;
+
+// A request delivered to a CompletionQueueState, identified by `id`
+typedef struct {
+    MpscNode node;
+    CompletionQueueState* state;
+    CassFuture* future;
+    FutureKind kind;
+    long id;
+    FutureListenerFn on_complete;  // Optional, runs on the driver thread
+    void* on_complete_data;
+} CompletionNode;
+
+typedef struct {
+    CompletionQueueState* state;   // Shared with in-flight driver callbacks
+    MpscNode* ready;               // Collected completions not yet returned by #poll
+    MpscNode* ready_tail;          // Last node of `ready` (meaningless while it is empty)
+    VALUE tags;                    // Request id => tag
+    long next_id;
+    long pending;                  // Submitted but not yet polled
+} CompletionQueueWrapper;
+
 typedef struct {
     const CassPrepared* prepared;
+    VALUE result_metadata;  // Shared by Results of this statement; nil until the first one
 } PreparedWrapper;
 
 typedef struct {
     CassStatement* statement;
+    VALUE prepared;         // Prepared this statement was bound from, or nil
+    int deadline_timeout;   // A `deadline:` request timeout is set on the statement
+    int page_size;          // Set by page_size=, or -1 (paging disabled, the driver default)
 } StatementWrapper;
 
+// Converts one non-null value of a known CQL type (see value_decoder_for)
+typedef VALUE (*ValueDecoderFn)(const CassValue* value);
+
 typedef struct {
     CassResult* result;
+    ValueDecoderFn* decoders;   // Per-column decoders, resolved on first use
+    ValueDecoderFn* custom_decoders;    // Decoders adjusted for the options below, or NULL
+    int binary_ids;             // Decode UUID, TimeUUID and inet columns as bytes
+    char* intern_mask;          // Columns decoded as interned Strings, or NULL
+    int blob_views;             // Decode blob columns as IO::Buffer views
+    VALUE session;              // Session and Statement that fetch the following
+    VALUE statement;            // pages (Result#each_across_pages), or nil
+    VALUE metadata;             // Metadata shared through a Prepared, or nil
+    size_t payload_size;        // Row data bytes reported to the GC
+    VALUE views;                // Live blob views into the row data (a WeakMap), or nil
+    int iterating;              // Row iterations in progress (Result#free waits for none)
+    CassIterator* cursor;   // Row iterator used by Row objects, created lazily
+    size_t cursor_next;     // Index of the row the cursor's next advance reaches
 } ResultWrapper;
 
+// A row of a Result whose columns are decoded on first access
+typedef struct {
+    VALUE result;           // Keeps the CassResult (and its row data) alive
+    size_t index;
+    size_t column_count;
+    VALUE* values;          // Decoded columns; Qundef until first accessed
+} RowWrapper;
+
 typedef struct {
     CassBatch* batch;
+    cass_uint64_t request_timeout_ms;   // Set by request_timeout=, CASS_UINT64_MAX when unset
+    int deadline_timeout;               // A `deadline:` request timeout replaced it
 } BatchWrapper;
 
 // ============================================================================
@@ -75,7 +182,9 @@ extern const rb_data_type_t future_type;
 extern const rb_data_type_t prepared_type;
 extern const rb_data_type_t statement_type;
 extern const rb_data_type_t result_type;
+extern const rb_data_type_t row_type;
 extern const rb_data_type_t batch_type;
+extern const rb_data_type_t completion_queue_type;
 
 // ============================================================================
 // Ruby Class Declarations
@@ -83,9 +192,11 @@ extern const rb_data_type_t batch_type;
 
 extern VALUE cCassStatement;
 extern VALUE cCassResult;
+extern VALUE cCassRow;
 extern VALUE cCassFuture;
 extern VALUE cCassPrepared;
 extern VALUE cCassBatch;
+extern VALUE cCassCompletionQueue;
 
 // ============================================================================
 // Core Function Declarations
@@ -98,15 +209,114 @@ void raise_future_error(CassFuture* future, const char* prefix) __attribute__((n
 // Shared utility functions
 CassConsistency ruby_value_to_consistency(VALUE consistency);
 
+// Live native handles and driver memory (CassandraC::Native.stats)
+typedef enum {
+    NATIVE_STATEMENTS,
+    NATIVE_FUTURES,
+    NATIVE_RESULTS,
+    NATIVE_PREPARED,
+    NATIVE_BATCHES,
+    NATIVE_HANDLE_KINDS
+} NativeHandleKind;
+void native_handle_created(NativeHandleKind kind);
+void native_handle_freed(NativeHandleKind kind);
+void native_memory_adjust(ssize_t diff);
+
+// Future waiting without holding the GVL
+#define FUTURE_WAIT_FOREVER (-1)
+cass_bool_t future_wait_without_gvl(CassFuture* future, cass_int64_t timeout_us, int owned);
+cass_bool_t future_wait_with_completion(CassFuture* future, FutureCompletion** completion_slot,
+                                        cass_int64_t timeout_us, int owned);
+cass_int64_t monotonic_us(void);
+
+// Lock-free completion stack
+int mpsc_push(MpscStack* stack, MpscNode* node);
+MpscNode* mpsc_drain(MpscStack* stack);
+
+// Future completion notifications
+FutureCompletion* future_completion_new(CassFuture* future);
+void future_completion_listen(FutureCompletion* completion, FutureListenerFn fn, void* data);
+void future_completion_release(FutureCompletion* completion);
+void future_listen(VALUE future, FutureListenerFn fn, void* data);
+
+// Completion queues: native state shared with driver callbacks, and the
+// CompletionQueue object submission (both take ownership of the future)
+CompletionQueueState* completion_queue_state_new(void);
+void completion_queue_state_release(CompletionQueueState* state);
+void completion_queue_state_submit(CompletionQueueState* state, CassFuture* future, FutureKind kind, long id,
+                                   FutureListenerFn on_complete, void* on_complete_data);
+MpscNode* completion_queue_state_wait(CompletionQueueState* state, double timeout);
+void completion_node_free(CompletionNode* node);
+void completion_queue_submit(VALUE queue, CassFuture* future, FutureKind kind, VALUE tag,
+                             FutureListenerFn on_complete, void* on_complete_data);
+
+// Release an in-flight slot taken by a Session request
+void session_limiter_release(void* limiter);
+
+// Start executing `statement` on `session` as the driver future of `future`
+void session_execute_into(VALUE session, StatementWrapper* statement, VALUE future);
+VALUE session_each_page_from(VALUE session, VALUE statement, VALUE first_page, int rows);
+
 // Object creation functions
-VALUE future_new(CassFuture* future);
+VALUE future_new(CassFuture* future, FutureKind kind);
+VALUE future_resolve_value(CassFuture* future, FutureKind kind);
+VALUE future_value(VALUE future);
+int future_is_ready(VALUE future);
+void future_attach(VALUE future, CassFuture* cass_future, FutureKind kind);
+void future_set_deadline(VALUE future, cass_int64_t deadline_us);
+void future_set_prepared(VALUE future, VALUE prepared);
+void future_set_source(VALUE future, VALUE session, VALUE statement);
 VALUE prepared_new(const CassPrepared* prepared);
 VALUE statement_new(CassStatement* statement);
 VALUE result_new(CassResult* result);
+
+// Wrappers whose native handle is still alive; raise once Statement#free or
+// Result#free has been called
+StatementWrapper* statement_get(VALUE statement);
+ResultWrapper* result_get(VALUE result);
+VALUE result_free_now(VALUE result);
+VALUE row_new(VALUE result, size_t index, size_t column_count);
+const CassRow* result_row_at(VALUE result, size_t index);
+long result_column_index_by_name(VALUE result, VALUE name);
+
+// Share column metadata between the Results of a prepared statement
+void result_use_prepared_metadata(VALUE result, VALUE prepared);
+VALUE prepared_result_metadata(VALUE prepared);
+void prepared_publish_result_metadata(VALUE prepared, VALUE expected, VALUE metadata);
+void result_set_source(VALUE result, VALUE session, VALUE statement);
+VALUE result_metadata_columns(VALUE metadata);
 VALUE batch_new(CassBatch* batch);
 
+// Set the request timeout of an execute with a `deadline:`, or restore the
+// timeout an earlier deadline replaced (deadline_us is FUTURE_WAIT_FOREVER)
+void statement_apply_deadline(StatementWrapper* wrapper, cass_int64_t deadline_us, cass_uint64_t timeout_ms);
+void batch_apply_deadline(BatchWrapper* wrapper, cass_int64_t deadline_us, cass_uint64_t timeout_ms);
+
+// Bind positional parameters to a statement; on failure *failed_index is set
+CassError bind_positional_params(CassStatement* statement, VALUE params, long* failed_index);
+
 // Value conversion
 VALUE cass_value_to_ruby(const CassValue* value);
+ValueDecoderFn value_decoder_for(CassValueType type);
+ValueDecoderFn value_binary_decoder_for(CassValueType type);
+ValueDecoderFn value_interned_decoder_for(CassValueType type);
+VALUE value_blob_view(const CassValue* value);
+void value_blob_view_release(VALUE view);
+int value_blob_views_supported(void);
+VALUE cass_value_type_symbol(CassValueType type);
+VALUE uuid_to_rb_str(CassUuid uuid);
+
+// Decode a value with its column's decoder, mapping NULL to nil
+static inline VALUE cass_value_decode(ValueDecoderFn decoder, const CassValue* value) {
+    if (value == NULL || cass_value_is_null(value)) {
+        return Qnil;
+    }
+    return decoder(value);
+}
+
+// Per-column decoders for a result, resolved once per Result
+ValueDecoderFn* result_decoders(VALUE result);
+VALUE result_decode_cell(VALUE result, ValueDecoderFn decoder, const CassValue* value);
 CassError ruby_value_to_cass_statement(CassStatement* statement, size_t index, VALUE rb_value);
 CassError ruby_value_to_cass_statement_by_name(CassStatement* statement, const char* name, VALUE rb_value);
 
@@ -164,6 +374,9 @@ void Init_cassandra_c_future(VALUE module);
 void Init_cassandra_c_prepared(VALUE module);
 void Init_cassandra_c_statement(VALUE module);
 void Init_cassandra_c_result(VALUE module);
+void Init_cassandra_c_row(VALUE module);
+void Init_cassandra_c_value(VALUE module);
 void Init_cassandra_c_batch(VALUE module);
+void Init_cassandra_c_completion_queue(VALUE module);
 
 #endif /* CASSANDRA_C_H */
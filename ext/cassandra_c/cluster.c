@@ -1,4 +1,5 @@
 #include "cassandra_c.h"
+#include "ruby/ractor.h"
 
 // Memory management for Cluster
 static void cluster_free(void* ptr) {
@@ -9,7 +10,8 @@ static void cluster_free(void* ptr) {
     xfree(wrapper);
 }
 
-// Define the Ruby data type for Cluster
+// Define the Ruby data type for Cluster. A frozen Cluster can be shared
+// between Ractors: its configuration can no longer change.
 const rb_data_type_t cluster_type = {
     .wrap_struct_name = "CassCluster",
     .function = {
@@ -18,7 +20,7 @@ const rb_data_type_t cluster_type = {
         .dsize = NULL,
     },
     .data = NULL,
-    .flags = RUBY_TYPED_FREE_IMMEDIATELY
+    .flags = RUBY_TYPED_FREE_IMMEDIATELY | RUBY_TYPED_FROZEN_SHAREABLE
 };
 
 // Allocation function for Cluster
@@ -38,6 +40,7 @@ static VALUE rb_cluster_initialize(VALUE self) {
 }
 
 static VALUE rb_cluster_set_contact_points(VALUE self, VALUE contact_points) {
+    rb_check_frozen(self);
     ClusterWrapper* wrapper;
     TypedData_Get_Struct(self, ClusterWrapper, &cluster_type, wrapper);
     Check_Type(contact_points, T_STRING);
@@ -49,6 +52,7 @@ static VALUE rb_cluster_set_contact_points(VALUE self, VALUE contact_points) {
 }
 
 static VALUE rb_cluster_set_port(VALUE self, VALUE port) {
+    rb_check_frozen(self);
     ClusterWrapper* wrapper;
     TypedData_Get_Struct(self, ClusterWrapper, &cluster_type, wrapper);
     CassError error = cass_cluster_set_port(wrapper->cluster, NUM2INT(port));
@@ -59,6 +63,7 @@ static VALUE rb_cluster_set_port(VALUE self, VALUE port) {
 }
 
 static VALUE rb_cluster_set_protocol_version(VALUE self, VALUE protocol_version) {
+    rb_check_frozen(self);
     ClusterWrapper* wrapper;
     TypedData_Get_Struct(self, ClusterWrapper, &cluster_type, wrapper);
     CassError error = cass_cluster_set_protocol_version(wrapper->cluster, NUM2INT(protocol_version));
@@ -69,6 +74,7 @@ static VALUE rb_cluster_set_protocol_version(VALUE self, VALUE protocol_version)
 }
 
 static VALUE rb_cluster_set_num_threads_io(VALUE self, VALUE num_threads) {
+    rb_check_frozen(self);
     ClusterWrapper* wrapper;
     TypedData_Get_Struct(self, ClusterWrapper, &cluster_type, wrapper);
     CassError error = cass_cluster_set_num_threads_io(wrapper->cluster, NUM2UINT(num_threads));
@@ -79,6 +85,7 @@ static VALUE rb_cluster_set_num_threads_io(VALUE self, VALUE num_threads) {
 }
 
 static VALUE rb_cluster_set_queue_size_io(VALUE self, VALUE queue_size) {
+    rb_check_frozen(self);
     ClusterWrapper* wrapper;
     TypedData_Get_Struct(self, ClusterWrapper, &cluster_type, wrapper);
     CassError error = cass_cluster_set_queue_size_io(wrapper->cluster, NUM2UINT(queue_size));
@@ -89,6 +96,7 @@ static VALUE rb_cluster_set_queue_size_io(VALUE self, VALUE queue_size) {
 }
 
 static VALUE rb_cluster_set_local_address(VALUE self, VALUE address) {
+    rb_check_frozen(self);
     ClusterWrapper* wrapper;
     TypedData_Get_Struct(self, ClusterWrapper, &cluster_type, wrapper);
     Check_Type(address, T_STRING);
@@ -103,6 +111,7 @@ static VALUE rb_cluster_set_local_address(VALUE self, VALUE address) {
 VALUE consistency_map;
 
 static VALUE rb_cluster_set_consistency(VALUE self, VALUE consistency) {
+    rb_check_frozen(self);
     ClusterWrapper* wrapper;
     TypedData_Get_Struct(self, ClusterWrapper, &cluster_type, wrapper);
     
@@ -116,6 +125,7 @@ static VALUE rb_cluster_set_consistency(VALUE self, VALUE consistency) {
 }
 
 static VALUE rb_cluster_set_load_balance_round_robin(VALUE self) {
+    rb_check_frozen(self);
     ClusterWrapper* wrapper;
     TypedData_Get_Struct(self, ClusterWrapper, &cluster_type, wrapper);
     
@@ -125,6 +135,7 @@ static VALUE rb_cluster_set_load_balance_round_robin(VALUE self) {
 }
 
 static VALUE rb_cluster_set_load_balance_dc_aware(VALUE self, VALUE local_dc) {
+    rb_check_frozen(self);
     ClusterWrapper* wrapper;
     TypedData_Get_Struct(self, ClusterWrapper, &cluster_type, wrapper);
     
@@ -162,6 +173,7 @@ static CassRetryPolicy* create_logging_retry_policy(CassRetryPolicy* child_polic
 
 // Custom Ruby object to hold the retry policy setting
 static VALUE rb_cluster_set_default_retry_policy(VALUE self) {
+    rb_check_frozen(self);
     ClusterWrapper* wrapper;
     TypedData_Get_Struct(self, ClusterWrapper, &cluster_type, wrapper);
     
@@ -173,6 +185,7 @@ static VALUE rb_cluster_set_default_retry_policy(VALUE self) {
 }
 
 static VALUE rb_cluster_set_fallthrough_retry_policy(VALUE self) {
+    rb_check_frozen(self);
     ClusterWrapper* wrapper;
     TypedData_Get_Struct(self, ClusterWrapper, &cluster_type, wrapper);
     
@@ -184,6 +197,7 @@ static VALUE rb_cluster_set_fallthrough_retry_policy(VALUE self) {
 }
 
 static VALUE rb_cluster_set_logging_retry_policy(VALUE self, VALUE child_policy_type) {
+    rb_check_frozen(self);
     ClusterWrapper* wrapper;
     TypedData_Get_Struct(self, ClusterWrapper, &cluster_type, wrapper);
     
@@ -229,8 +243,8 @@ static void init_consistency_map() {
     rb_hash_aset(consistency_map, ID2SYM(rb_intern("local_serial")), INT2NUM(CASS_CONSISTENCY_LOCAL_SERIAL));
     rb_hash_aset(consistency_map, ID2SYM(rb_intern("local_one")), INT2NUM(CASS_CONSISTENCY_LOCAL_ONE));
     
-    // Freeze the hash to prevent modification
-    rb_hash_freeze(consistency_map);
+    // Freeze the hash so every Ractor can read it
+    rb_ractor_make_shareable(consistency_map);
 }
 
 void Init_cassandra_c_cluster(VALUE module) {
@@ -0,0 +1,356 @@
+#include "cassandra_c.h"
+#include "ruby/thread.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+VALUE cCassCompletionQueue;
+
+// ============================================================================
+// Native Queue State
+// ============================================================================
+
+// Shared between the owner of a queue (a CompletionQueue object or a native
+// pipeline such as Session#execute_concurrent) and the driver callbacks of
+// every request submitted to it. Reference counted (one reference for the
+// owner plus one per in-flight request) so a request may complete after the
+// owner has gone away.
+struct CompletionQueueState {
+    MpscStack completed;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int signaled;
+    int interrupted;
+    int refs;
+};
+
+void completion_node_free(CompletionNode* node) {
+    cass_future_free(node->future);
+    free(node);
+}
+
+static void completion_node_free_list(MpscNode* node) {
+    while (node != NULL) {
+        MpscNode* next = node->next;
+        completion_node_free((CompletionNode*)node);
+        node = next;
+    }
+}
+
+CompletionQueueState* completion_queue_state_new(void) {
+    CompletionQueueState* state = malloc(sizeof(CompletionQueueState));
+    if (state == NULL) {
+        rb_raise(rb_eNoMemError, "failed to allocate completion queue");
+    }
+    state->completed.head = NULL;
+    pthread_mutex_init(&state->lock, NULL);
+    pthread_cond_init(&state->cond, NULL);
+    state->signaled = 0;
+    state->interrupted = 0;
+    state->refs = 1;
+    return state;
+}
+
+void completion_queue_state_release(CompletionQueueState* state) {
+    pthread_mutex_lock(&state->lock);
+    int refs = --state->refs;
+    pthread_mutex_unlock(&state->lock);
+    if (refs != 0) {
+        return;
+    }
+
+    // Nobody can collect any more: drop completions that were never taken
+    completion_node_free_list(mpsc_drain(&state->completed));
+    pthread_cond_destroy(&state->cond);
+    pthread_mutex_destroy(&state->lock);
+    free(state);
+}
+
+// Driver callback, usually on an IO thread: must not touch any Ruby objects
+static void completion_queue_callback(CassFuture* future, void* data) {
+    CompletionNode* node = (CompletionNode*)data;
+    CompletionQueueState* state = node->state;
+
+    if (node->on_complete != NULL) {
+        node->on_complete(node->on_complete_data);
+    }
+    if (mpsc_push(&state->completed, &node->node)) {
+        pthread_mutex_lock(&state->lock);
+        state->signaled = 1;
+        pthread_cond_signal(&state->cond);
+        pthread_mutex_unlock(&state->lock);
+    }
+    completion_queue_state_release(state);
+}
+
+// Deliver `future`'s completion to `state` under `id`. Takes ownership of the
+// future, freeing it and raising if the callback cannot be registered. The
+// optional `on_complete` listener runs once, before the completion is queued
+// (or immediately if submission fails).
+void completion_queue_state_submit(CompletionQueueState* state, CassFuture* future, FutureKind kind, long id,
+                                   FutureListenerFn on_complete, void* on_complete_data) {
+    CompletionNode* node = malloc(sizeof(CompletionNode));
+    if (node == NULL) {
+        cass_future_free(future);
+        if (on_complete != NULL) {
+            on_complete(on_complete_data);
+        }
+        rb_raise(rb_eNoMemError, "failed to allocate completion queue entry");
+    }
+    node->state = state;
+    node->future = future;
+    node->kind = kind;
+    node->id = id;
+    node->on_complete = on_complete;
+    node->on_complete_data = on_complete_data;
+
+    pthread_mutex_lock(&state->lock);
+    state->refs++;
+    pthread_mutex_unlock(&state->lock);
+
+    // May run the callback immediately if the request has already completed
+    CassError rc = cass_future_set_callback(future, completion_queue_callback, node);
+    if (rc != CASS_OK) {
+        if (on_complete != NULL) {
+            on_complete(on_complete_data);
+        }
+        completion_queue_state_release(state);
+        completion_node_free(node);
+        raise_cassandra_error(rc, "Failed to register completion queue callback");
+    }
+}
+
+typedef struct {
+    CompletionQueueState* state;
+    int timed;
+    struct timespec abstime;
+} CompletionQueueWaitArgs;
+
+static void* completion_queue_wait_nogvl(void* ptr) {
+    CompletionQueueWaitArgs* args = (CompletionQueueWaitArgs*)ptr;
+    CompletionQueueState* state = args->state;
+
+    pthread_mutex_lock(&state->lock);
+    while (!state->signaled && !state->interrupted) {
+        if (args->timed) {
+            if (pthread_cond_timedwait(&state->cond, &state->lock, &args->abstime) == ETIMEDOUT) {
+                break;
+            }
+        } else {
+            pthread_cond_wait(&state->cond, &state->lock);
+        }
+    }
+    state->signaled = 0;
+    pthread_mutex_unlock(&state->lock);
+    return NULL;
+}
+
+static void completion_queue_wait_ubf(void* ptr) {
+    CompletionQueueWaitArgs* args = (CompletionQueueWaitArgs*)ptr;
+    CompletionQueueState* state = args->state;
+
+    pthread_mutex_lock(&state->lock);
+    state->interrupted = 1;
+    pthread_cond_signal(&state->cond);
+    pthread_mutex_unlock(&state->lock);
+}
+
+static void timespec_add_ns(struct timespec* ts, cass_int64_t ns) {
+    cass_int64_t nsec = ts->tv_nsec + ns % 1000000000;
+    ts->tv_sec += (time_t)(ns / 1000000000 + nsec / 1000000000);
+    ts->tv_nsec = (long)(nsec % 1000000000);
+}
+
+// Take every completion delivered so far, in FIFO order. If there are none,
+// wait without the GVL for up to `timeout` seconds (forever when negative,
+// not at all when 0). Returns NULL on timeout. Interrupts (Thread#raise,
+// signals) propagate as exceptions; the caller still owns its reference.
+MpscNode* completion_queue_state_wait(CompletionQueueState* state, double timeout) {
+    MpscNode* completed = mpsc_drain(&state->completed);
+    if (completed != NULL || timeout == 0) {
+        return completed;
+    }
+
+    CompletionQueueWaitArgs args;
+    args.state = state;
+    args.timed = timeout > 0;
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    if (args.timed) {
+        cass_int64_t timeout_ns = (cass_int64_t)(timeout * 1000000000.0);
+        clock_gettime(CLOCK_REALTIME, &args.abstime);
+        timespec_add_ns(&args.abstime, timeout_ns);
+        timespec_add_ns(&deadline, timeout_ns);
+    }
+
+    for (;;) {
+        pthread_mutex_lock(&state->lock);
+        state->interrupted = 0;
+        pthread_mutex_unlock(&state->lock);
+
+        rb_thread_call_without_gvl(completion_queue_wait_nogvl, &args, completion_queue_wait_ubf, &args);
+        completed = mpsc_drain(&state->completed);
+        if (completed != NULL) {
+            return completed;
+        }
+
+        if (args.timed) {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            if (now.tv_sec > deadline.tv_sec ||
+                (now.tv_sec == deadline.tv_sec && now.tv_nsec >= deadline.tv_nsec)) {
+                return NULL;
+            }
+        }
+        rb_thread_check_ints();
+    }
+}
+
+// ============================================================================
+// CompletionQueue Class
+// ============================================================================
+
+static void completion_queue_mark(void* ptr) {
+    CompletionQueueWrapper* wrapper = (CompletionQueueWrapper*)ptr;
+    rb_gc_mark(wrapper->tags);
+}
+
+static void completion_queue_free(void* ptr) {
+    CompletionQueueWrapper* wrapper = (CompletionQueueWrapper*)ptr;
+    completion_node_free_list(wrapper->ready);
+    if (wrapper->state != NULL) {
+        completion_queue_state_release(wrapper->state);
+    }
+    xfree(wrapper);
+}
+
+const rb_data_type_t completion_queue_type = {
+    .wrap_struct_name = "CassCompletionQueue",
+    .function = {
+        .dmark = completion_queue_mark,
+        .dfree = completion_queue_free,
+        .dsize = NULL,
+    },
+    .data = NULL,
+    .flags = RUBY_TYPED_FREE_IMMEDIATELY
+};
+
+static VALUE completion_queue_allocate(VALUE klass) {
+    CompletionQueueWrapper* wrapper = ALLOC(CompletionQueueWrapper);
+    wrapper->state = NULL;
+    wrapper->ready = NULL;
+    wrapper->ready_tail = NULL;
+    wrapper->tags = Qnil;
+    wrapper->next_id = 0;
+    wrapper->pending = 0;
+    VALUE self = TypedData_Wrap_Struct(klass, &completion_queue_type, wrapper);
+
+    wrapper->state = completion_queue_state_new();
+    wrapper->tags = rb_hash_new();
+    return self;
+}
+
+// Route a request's completion to `queue` instead of a Future. Takes ownership
+// of `future`; `tag` is returned alongside the value by #poll.
+void completion_queue_submit(VALUE queue, CassFuture* future, FutureKind kind, VALUE tag,
+                             FutureListenerFn on_complete, void* on_complete_data) {
+    CompletionQueueWrapper* wrapper;
+    TypedData_Get_Struct(queue, CompletionQueueWrapper, &completion_queue_type, wrapper);
+
+    long id = wrapper->next_id++;
+    completion_queue_state_submit(wrapper->state, future, kind, id, on_complete, on_complete_data);
+    wrapper->pending++;
+
+    // Untagged requests cost no hash insert; #poll reports their tag as nil
+    if (!NIL_P(tag)) {
+        rb_hash_aset(wrapper->tags, LONG2NUM(id), tag);
+    }
+}
+
+// Append a FIFO batch of completions to the ready list. Only the new batch is
+// walked (to find its tail), so appending stays linear in what was collected.
+static void completion_queue_append(CompletionQueueWrapper* wrapper, MpscNode* batch) {
+    if (batch == NULL) {
+        return;
+    }
+    if (wrapper->ready == NULL) {
+        wrapper->ready = batch;
+    } else {
+        wrapper->ready_tail->next = batch;
+    }
+
+    MpscNode* tail = batch;
+    while (tail->next != NULL) {
+        tail = tail->next;
+    }
+    wrapper->ready_tail = tail;
+}
+
+// Collect up to `max:` (default 256) completions as [tag, value] pairs, where
+// value is a Result, Prepared or a CassandraC::Error for failed requests. Waits
+// up to `timeout:` seconds (forever when nil, never when 0) for the first
+// completion and returns an empty array if none arrived, or straight away when
+// nothing is pending.
+static VALUE completion_queue_poll(int argc, VALUE* argv, VALUE self) {
+    VALUE options;
+    rb_scan_args(argc, argv, "0:", &options);
+
+    CompletionQueueWrapper* wrapper;
+    TypedData_Get_Struct(self, CompletionQueueWrapper, &completion_queue_type, wrapper);
+
+    VALUE rb_max = Qnil;
+    VALUE rb_timeout = Qnil;
+    if (!NIL_P(options)) {
+        rb_max = rb_hash_aref(options, ID2SYM(rb_intern("max")));
+        rb_timeout = rb_hash_aref(options, ID2SYM(rb_intern("timeout")));
+    }
+
+    long max = NIL_P(rb_max) ? 256 : NUM2LONG(rb_max);
+    if (max <= 0) {
+        rb_raise(rb_eArgError, "max must be positive");
+    }
+    double timeout = -1;
+    if (!NIL_P(rb_timeout)) {
+        timeout = NUM2DBL(rb_timeout);
+        if (timeout < 0) {
+            rb_raise(rb_eArgError, "timeout must not be negative");
+        }
+    }
+
+    // Nothing submitted is outstanding, so no completion can arrive
+    if (wrapper->pending == 0) {
+        return rb_ary_new();
+    }
+
+    // Only block when nothing collected earlier is still waiting to be returned
+    completion_queue_append(wrapper, completion_queue_state_wait(wrapper->state, wrapper->ready ? 0 : timeout));
+
+    VALUE pairs = rb_ary_new();
+    while (wrapper->ready != NULL && RARRAY_LEN(pairs) < max) {
+        CompletionNode* node = (CompletionNode*)wrapper->ready;
+        wrapper->ready = node->node.next;
+        wrapper->pending--;
+
+        VALUE tag = rb_hash_delete(wrapper->tags, LONG2NUM(node->id));
+        VALUE value = future_resolve_value(node->future, node->kind);
+        completion_node_free(node);
+        rb_ary_push(pairs, rb_assoc_new(tag, value));
+    }
+    return pairs;
+}
+
+// Number of submitted requests whose completions have not been polled yet
+static VALUE completion_queue_pending(VALUE self) {
+    CompletionQueueWrapper* wrapper;
+    TypedData_Get_Struct(self, CompletionQueueWrapper, &completion_queue_type, wrapper);
+    return LONG2NUM(wrapper->pending);
+}
+
+// Initialize the CompletionQueue class
+void Init_cassandra_c_completion_queue(VALUE module) {
+    cCassCompletionQueue = rb_define_class_under(module, "CompletionQueue", rb_cObject);
+    rb_define_alloc_func(cCassCompletionQueue, completion_queue_allocate);
+    rb_define_method(cCassCompletionQueue, "poll", completion_queue_poll, -1);
+    rb_define_method(cCassCompletionQueue, "pending", completion_queue_pending, 0);
+}
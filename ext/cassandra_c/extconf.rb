@@ -14,4 +14,10 @@ unless have_library("cassandra") && have_header("cassandra.h")
   abort "Cassandra C/C++ driver is missing. Please install it."
 end
 
+# Fiber scheduler C API (Ruby 3.1+)
+have_header("ruby/fiber/scheduler.h")
+
+# IO::Buffer C API (Ruby 3.1+), used for zero-copy blob views
+have_header("ruby/io/buffer.h")
+
 create_makefile("cassandra_c/cassandra_c")
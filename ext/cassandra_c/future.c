@@ -1,23 +1,461 @@
 #include "cassandra_c.h"
+#include "ruby/thread.h"
+#include "ruby/io.h"
+#include "ruby/atomic.h"
+#include "ruby/ractor.h"
+#ifdef HAVE_RUBY_FIBER_SCHEDULER_H
+#include "ruby/fiber/scheduler.h"
+#endif
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
 
 VALUE cCassFuture;
 
+// ============================================================================
+// Completion Notifications
+// ============================================================================
+
+typedef struct FutureListener {
+    FutureListenerFn fn;
+    void* data;
+    struct FutureListener* next;
+} FutureListener;
+
+// Shared between Ruby threads and the driver callback. Plain malloc/free are
+// used throughout because the callback runs on an IO thread outside Ruby.
+struct FutureCompletion {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int completed;
+    int refs;
+    FutureListener* listeners;
+    int notify_fds[2];          // Pipe written on completion for Fiber-scheduler waits, or -1
+};
+
+// Make the notification pipe readable; the byte is never read, so every
+// waiter sees it
+static void future_completion_notify(int fd) {
+    ssize_t written;
+    do {
+        written = write(fd, "!", 1);
+    } while (written < 0 && errno == EINTR);
+}
+
+static void future_completion_callback(CassFuture* future, void* data) {
+    FutureCompletion* completion = (FutureCompletion*)data;
+
+    pthread_mutex_lock(&completion->lock);
+    completion->completed = 1;
+    FutureListener* listeners = completion->listeners;
+    completion->listeners = NULL;
+    int notify_fd = completion->notify_fds[1];
+    pthread_cond_broadcast(&completion->cond);
+    pthread_mutex_unlock(&completion->lock);
+
+    // The pipe is open while this callback holds its reference
+    if (notify_fd >= 0) {
+        future_completion_notify(notify_fd);
+    }
+
+    // Listeners are pushed LIFO; run them in registration order
+    FutureListener* ordered = NULL;
+    while (listeners != NULL) {
+        FutureListener* next = listeners->next;
+        listeners->next = ordered;
+        ordered = listeners;
+        listeners = next;
+    }
+    while (ordered != NULL) {
+        FutureListener* next = ordered->next;
+        ordered->fn(ordered->data);
+        free(ordered);
+        ordered = next;
+    }
+
+    future_completion_release(completion);
+}
+
+// Register the driver callback for a future. The returned completion holds one
+// reference for the caller and one for the driver callback.
+FutureCompletion* future_completion_new(CassFuture* future) {
+    FutureCompletion* completion = (FutureCompletion*)malloc(sizeof(FutureCompletion));
+    if (completion == NULL) {
+        rb_raise(rb_eNoMemError, "failed to allocate future completion");
+    }
+    pthread_mutex_init(&completion->lock, NULL);
+    pthread_cond_init(&completion->cond, NULL);
+    completion->completed = 0;
+    completion->refs = 2;
+    completion->listeners = NULL;
+    completion->notify_fds[0] = -1;
+    completion->notify_fds[1] = -1;
+
+    CassError error = cass_future_set_callback(future, future_completion_callback, completion);
+    if (error != CASS_OK) {
+        pthread_cond_destroy(&completion->cond);
+        pthread_mutex_destroy(&completion->lock);
+        free(completion);
+        raise_cassandra_error(error, "Failed to register future callback");
+    }
+
+    return completion;
+}
+
+// Run `fn(data)` once the future completes; immediately if it already has
+void future_completion_listen(FutureCompletion* completion, FutureListenerFn fn, void* data) {
+    FutureListener* listener = (FutureListener*)malloc(sizeof(FutureListener));
+    if (listener == NULL) {
+        rb_raise(rb_eNoMemError, "failed to allocate future listener");
+    }
+    listener->fn = fn;
+    listener->data = data;
+
+    pthread_mutex_lock(&completion->lock);
+    if (!completion->completed) {
+        listener->next = completion->listeners;
+        completion->listeners = listener;
+        pthread_mutex_unlock(&completion->lock);
+        return;
+    }
+    pthread_mutex_unlock(&completion->lock);
+
+    free(listener);
+    fn(data);
+}
+
+void future_completion_release(FutureCompletion* completion) {
+    pthread_mutex_lock(&completion->lock);
+    int refs = --completion->refs;
+    pthread_mutex_unlock(&completion->lock);
+
+    if (refs == 0) {
+        if (completion->notify_fds[0] >= 0) {
+            close(completion->notify_fds[0]);
+            close(completion->notify_fds[1]);
+        }
+        pthread_cond_destroy(&completion->cond);
+        pthread_mutex_destroy(&completion->lock);
+        free(completion);
+    }
+}
+
+// ============================================================================
+// Lock-free Completion Stack
+// ============================================================================
+
+// Push a node; returns 1 if the stack was empty so the consumer may need waking
+int mpsc_push(MpscStack* stack, MpscNode* node) {
+    MpscNode* head = stack->head;
+    for (;;) {
+        node->next = head;
+        MpscNode* seen = (MpscNode*)RUBY_ATOMIC_PTR_CAS(stack->head, head, node);
+        if (seen == head) {
+            return head == NULL;
+        }
+        head = seen;
+    }
+}
+
+// Detach every pushed node, returned in push (FIFO) order
+MpscNode* mpsc_drain(MpscStack* stack) {
+    MpscNode* node = (MpscNode*)RUBY_ATOMIC_PTR_EXCHANGE(stack->head, NULL);
+    MpscNode* ordered = NULL;
+    while (node != NULL) {
+        MpscNode* next = node->next;
+        node->next = ordered;
+        ordered = node;
+        node = next;
+    }
+    return ordered;
+}
+
+// ============================================================================
+// Waiting
+// ============================================================================
+
+// cass_future_wait() cannot be interrupted, so GVL-free waits are split into
+// timed slices. The unblocking function only has to wait for the current slice.
+#define FUTURE_WAIT_SLICE_US 10000
+
+typedef struct {
+    CassFuture* future;
+    cass_int64_t deadline_us;   // Monotonic deadline, or FUTURE_WAIT_FOREVER
+    volatile int interrupted;
+    cass_bool_t completed;
+} FutureWaitArgs;
+
+cass_int64_t monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (cass_int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Runs without the GVL: must not touch any Ruby objects
+static void* future_wait_nogvl(void* ptr) {
+    FutureWaitArgs* args = (FutureWaitArgs*)ptr;
+
+    while (!args->interrupted) {
+        cass_int64_t slice = FUTURE_WAIT_SLICE_US;
+        if (args->deadline_us != FUTURE_WAIT_FOREVER) {
+            cass_int64_t remaining = args->deadline_us - monotonic_us();
+            if (remaining <= 0) {
+                break;
+            }
+            if (remaining < slice) {
+                slice = remaining;
+            }
+        }
+        if (cass_future_wait_timed(args->future, (cass_duration_t)slice)) {
+            args->completed = cass_true;
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+// Unblocking function called by Ruby for Thread#raise, Thread#kill and signals
+static void future_wait_ubf(void* ptr) {
+    FutureWaitArgs* args = (FutureWaitArgs*)ptr;
+    args->interrupted = 1;
+}
+
+static VALUE future_check_ints(VALUE unused) {
+    rb_thread_check_ints();
+    return Qnil;
+}
+
+static cass_bool_t future_wait_thread(CassFuture* future, cass_int64_t deadline_us, int owned) {
+    FutureWaitArgs args;
+    args.future = future;
+    args.deadline_us = deadline_us;
+    args.completed = cass_false;
+
+    for (;;) {
+        args.interrupted = 0;
+        rb_thread_call_without_gvl(future_wait_nogvl, &args, future_wait_ubf, &args);
+
+        if (args.completed) {
+            return cass_true;
+        }
+        if (deadline_us != FUTURE_WAIT_FOREVER && monotonic_us() >= deadline_us) {
+            return cass_false;
+        }
+
+        // Interrupted: run signal handlers / pending Thread#raise, then resume
+        if (owned) {
+            int state = 0;
+            rb_protect(future_check_ints, Qnil, &state);
+            if (state) {
+                cass_future_free(future);
+                rb_jump_tag(state);
+            }
+        } else {
+            rb_thread_check_ints();
+        }
+    }
+}
+
+#ifdef HAVE_RUBY_FIBER_SCHEDULER_H
+// The read end of the completion's notification pipe, created on the first
+// Fiber-scheduler wait and shared by every later one, so repeated timed waits
+// on one future do not pile up descriptors or listeners. Returns -1 (with
+// errno set) if no pipe could be created.
+static int future_completion_notify_fd(FutureCompletion* completion) {
+    pthread_mutex_lock(&completion->lock);
+    int fd = completion->notify_fds[0];
+    pthread_mutex_unlock(&completion->lock);
+    if (fd >= 0) {
+        return fd;
+    }
+
+    int fds[2];
+    if (rb_cloexec_pipe(fds) != 0) {
+        return -1;
+    }
+    fcntl(fds[1], F_SETFL, fcntl(fds[1], F_GETFL) | O_NONBLOCK);
+
+    pthread_mutex_lock(&completion->lock);
+    int installed = completion->notify_fds[0] < 0;
+    if (installed) {
+        completion->notify_fds[0] = fds[0];
+        completion->notify_fds[1] = fds[1];
+    }
+    int completed = completion->completed;
+    fd = completion->notify_fds[0];
+    pthread_mutex_unlock(&completion->lock);
+
+    if (!installed) {
+        close(fds[0]);
+        close(fds[1]);
+    } else if (completed) {
+        // The driver callback ran before the pipe existed
+        future_completion_notify(fds[1]);
+    }
+    return fd;
+}
+
+typedef struct {
+    VALUE scheduler;
+    VALUE io;
+    VALUE timeout;
+} SchedulerWaitArgs;
+
+static VALUE future_scheduler_io_wait(VALUE ptr) {
+    SchedulerWaitArgs* args = (SchedulerWaitArgs*)ptr;
+    return rb_fiber_scheduler_io_wait(args->scheduler, args->io, RB_INT2NUM(RUBY_IO_READABLE), args->timeout);
+}
+
+// Park only the current fiber until the future completes or the deadline passes.
+// With `release_completion` set, the caller's reference is dropped on return.
+static cass_bool_t future_wait_fiber(VALUE scheduler, CassFuture* future, FutureCompletion* completion,
+                                     cass_int64_t deadline_us, int owned, int release_completion) {
+    int fd = future_completion_notify_fd(completion);
+    if (fd < 0) {
+        if (release_completion) {
+            future_completion_release(completion);
+        }
+        if (owned) {
+            cass_future_free(future);
+        }
+        rb_sys_fail("pipe");
+    }
+
+    // The completion owns the descriptor, so the IO must not close it
+    SchedulerWaitArgs args;
+    args.scheduler = scheduler;
+    args.io = rb_io_fdopen(fd, O_RDONLY, NULL);
+    rb_funcall(args.io, rb_intern("autoclose="), 1, Qfalse);
+
+    cass_bool_t completed = cass_false;
+    int state = 0;
+    for (;;) {
+        if (cass_future_ready(future)) {
+            completed = cass_true;
+            break;
+        }
+        if (deadline_us == FUTURE_WAIT_FOREVER) {
+            args.timeout = Qnil;
+        } else {
+            cass_int64_t remaining = deadline_us - monotonic_us();
+            if (remaining <= 0) {
+                break;
+            }
+            args.timeout = rb_float_new((double)remaining / 1000000.0);
+        }
+        rb_protect(future_scheduler_io_wait, (VALUE)&args, &state);
+        if (state) {
+            break;
+        }
+    }
+
+    if (release_completion) {
+        future_completion_release(completion);
+    }
+    if (state) {
+        if (owned) {
+            cass_future_free(future);
+        }
+        rb_jump_tag(state);
+    }
+    return completed;
+}
+#endif
+
+// Wait for a future without blocking other Ruby code. With an active Fiber
+// scheduler only the current fiber is parked; otherwise the GVL is released.
+// Returns cass_false if timeout_us elapsed first (FUTURE_WAIT_FOREVER never
+// times out). When `owned` is set the future is freed before an interrupt
+// exception propagates. `completion_slot` holds the future's completion when it
+// belongs to a Future object, or is NULL for a temporary one.
+static cass_bool_t future_wait_internal(CassFuture* future, FutureCompletion** completion_slot,
+                                        cass_int64_t timeout_us, int owned) {
+    cass_int64_t deadline_us = timeout_us < 0 ? FUTURE_WAIT_FOREVER : monotonic_us() + timeout_us;
+
+#ifdef HAVE_RUBY_FIBER_SCHEDULER_H
+    VALUE scheduler = rb_fiber_scheduler_current();
+    if (!NIL_P(scheduler) && !cass_future_ready(future)) {
+        if (completion_slot != NULL) {
+            if (*completion_slot == NULL) {
+                *completion_slot = future_completion_new(future);
+            }
+            return future_wait_fiber(scheduler, future, *completion_slot, deadline_us, owned, 0);
+        }
+
+        FutureCompletion* completion = future_completion_new(future);
+        return future_wait_fiber(scheduler, future, completion, deadline_us, owned, 1);
+    }
+#endif
+
+    return future_wait_thread(future, deadline_us, owned);
+}
+
+cass_bool_t future_wait_without_gvl(CassFuture* future, cass_int64_t timeout_us, int owned) {
+    return future_wait_internal(future, NULL, timeout_us, owned);
+}
+
+// Like future_wait_without_gvl, but a completion registered for the wait is
+// left in *completion_slot (which starts out NULL) for the caller to listen on
+// and release
+cass_bool_t future_wait_with_completion(CassFuture* future, FutureCompletion** completion_slot,
+                                        cass_int64_t timeout_us, int owned) {
+    return future_wait_internal(future, completion_slot, timeout_us, owned);
+}
+
+// ============================================================================
+// Future Class
+// ============================================================================
+
+// Mark function for Future
+static void future_mark(void* ptr) {
+    FutureWrapper* wrapper = (FutureWrapper*)ptr;
+    rb_gc_mark(wrapper->callbacks);
+    rb_gc_mark(wrapper->upstream);
+    rb_gc_mark(wrapper->argument);
+    rb_gc_mark(wrapper->value);
+    rb_gc_mark(wrapper->prepared);
+    rb_gc_mark(wrapper->session);
+    rb_gc_mark(wrapper->statement);
+}
+
+// Native.stats counts Futures that are neither released, cancelled nor
+// collected; a Future leaves the count at the first of those
+static void future_uncount(FutureWrapper* wrapper) {
+    if (wrapper->counted) {
+        wrapper->counted = 0;
+        native_handle_freed(NATIVE_FUTURES);
+    }
+}
+
 // Free function for Future
 static void future_free(void* ptr) {
     FutureWrapper* wrapper = (FutureWrapper*)ptr;
     if (wrapper->future != NULL) {
         cass_future_free(wrapper->future);
     }
+    if (wrapper->completion != NULL) {
+        future_completion_release(wrapper->completion);
+    }
+    future_uncount(wrapper);
     xfree(wrapper);
 }
 
+static size_t future_memsize(const void* ptr) {
+    return sizeof(FutureWrapper);
+}
+
 // Data type for Future
 const rb_data_type_t future_type = {
     .wrap_struct_name = "CassFuture",
     .function = {
-        .dmark = NULL,
+        .dmark = future_mark,
         .dfree = future_free,
-        .dsize = NULL,
+        .dsize = future_memsize,
     },
     .data = NULL,
     .flags = RUBY_TYPED_FREE_IMMEDIATELY
@@ -27,61 +465,926 @@ const rb_data_type_t future_type = {
 static VALUE future_allocate(VALUE klass) {
     FutureWrapper* wrapper = ALLOC(FutureWrapper);
     wrapper->future = NULL;
-    return TypedData_Wrap_Struct(klass, &future_type, wrapper);
+    wrapper->completion = NULL;
+    wrapper->kind = FUTURE_KIND_RESULT;
+    wrapper->callbacks = Qnil;
+    wrapper->dispatch_pending = 0;
+    wrapper->stage = FUTURE_STAGE_NONE;
+    wrapper->upstream = Qnil;
+    wrapper->argument = Qnil;
+    wrapper->value = Qundef;
+    wrapper->settling = 0;
+    wrapper->deadline_us = FUTURE_WAIT_FOREVER;
+    wrapper->cancelled = 0;
+    wrapper->released = 0;
+    wrapper->counted = 1;
+    wrapper->waiters = 0;
+    wrapper->prepared = Qnil;
+    wrapper->session = Qnil;
+    wrapper->statement = Qnil;
+    VALUE rb_future = TypedData_Wrap_Struct(klass, &future_type, wrapper);
+    native_handle_created(NATIVE_FUTURES);
+    return rb_future;
 }
 
-VALUE future_new(CassFuture* future) {
+VALUE future_new(CassFuture* future, FutureKind kind) {
     VALUE rb_future = future_allocate(cCassFuture);
     FutureWrapper* wrapper;
     TypedData_Get_Struct(rb_future, FutureWrapper, &future_type, wrapper);
     wrapper->future = future;
+    wrapper->kind = kind;
     return rb_future;
 }
 
-// Check if the Future is ready
-static VALUE future_ready(VALUE self) {
+// Bound waits on the future by a request deadline (monotonic microseconds)
+void future_set_deadline(VALUE self, cass_int64_t deadline_us) {
     FutureWrapper* wrapper;
     TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
-    return cass_future_ready(wrapper->future) ? Qtrue : Qfalse;
+    wrapper->deadline_us = deadline_us;
 }
 
-// Wait for the Future to complete
-static VALUE future_wait(VALUE self) {
+// Results of the future reuse the metadata cached on `prepared`
+void future_set_prepared(VALUE self, VALUE prepared) {
     FutureWrapper* wrapper;
     TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
-    cass_future_wait(wrapper->future);
+    wrapper->prepared = prepared;
+}
+
+// Results of the future fetch their following pages with `statement`
+void future_set_source(VALUE self, VALUE session, VALUE statement) {
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    wrapper->session = session;
+    wrapper->statement = statement;
+}
+
+// A Result resolved from the future adopts its prepared statement's metadata
+// and the Statement that fetches its following pages
+static VALUE future_adopt_metadata(FutureWrapper* wrapper, VALUE value) {
+    if (!rb_obj_is_kind_of(value, cCassResult)) {
+        return value;
+    }
+    if (!NIL_P(wrapper->prepared)) {
+        result_use_prepared_metadata(value, wrapper->prepared);
+    }
+    if (!NIL_P(wrapper->session)) {
+        result_set_source(value, wrapper->session, wrapper->statement);
+    }
+    return value;
+}
+
+static void future_free_listener(void* data) {
+    cass_future_free((CassFuture*)data);
+}
+
+// Hand the driver future over to its own completion: it is freed as soon as
+// the driver completes it (immediately if it already has)
+static void future_detach(FutureWrapper* wrapper) {
+    CassFuture* future = wrapper->future;
+    if (wrapper->completion == NULL) {
+        wrapper->completion = future_completion_new(future);
+    }
+    wrapper->future = NULL;
+    future_completion_listen(wrapper->completion, future_free_listener, future);
+}
+
+// Attach a native completion listener to a Future object (see FutureListenerFn)
+void future_listen(VALUE self, FutureListenerFn fn, void* data) {
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    if (wrapper->completion == NULL) {
+        wrapper->completion = future_completion_new(wrapper->future);
+    }
+    future_completion_listen(wrapper->completion, fn, data);
+}
+
+// Convert a completed future into its Ruby value: a Result, a Prepared or nil
+// depending on `kind`. Failures are returned (not raised) as CassandraC::Error.
+VALUE future_resolve_value(CassFuture* future, FutureKind kind) {
+    CassError error = cass_future_error_code(future);
+    if (error != CASS_OK) {
+        const char* message;
+        size_t message_length;
+        cass_future_error_message(future, &message, &message_length);
+        VALUE rb_message = rb_sprintf("Future error: %.*s", (int)message_length, message);
+        return rb_exc_new_str(rb_eCassandraError, rb_message);
+    }
+
+    switch (kind) {
+        case FUTURE_KIND_RESULT: {
+            const CassResult* result = cass_future_get_result(future);
+            // Cast away const since we transfer ownership to Ruby's GC via result_new
+            return result == NULL ? Qnil : result_new((CassResult*)result);
+        }
+        case FUTURE_KIND_PREPARED: {
+            const CassPrepared* prepared = cass_future_get_prepared(future);
+            return prepared == NULL ? Qnil : prepared_new(prepared);
+        }
+        default:
+            return Qnil;
+    }
+}
+
+// ============================================================================
+// Callback Dispatch
+// ============================================================================
+
+// Completion callbacks are run by one Ruby dispatcher thread per Ractor. Driver
+// IO threads only push a node onto that Ractor's lock-free stack and signal a
+// condition variable; the dispatcher drains whole batches and looks the futures
+// up in a registry that also keeps them alive until their callbacks have run.
+
+enum {
+    CALLBACK_ON_COMPLETE,
+    CALLBACK_ON_SUCCESS,
+    CALLBACK_ON_FAILURE,
+    CALLBACK_CONTINUE       // Settle a chained future (see Future#then)
+};
+
+typedef struct {
+    MpscStack pending;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int signaled;
+    int interrupted;
+    VALUE registry;     // id => Future awaiting dispatch
+    VALUE thread;
+    long next_id;
+} Dispatcher;
+
+typedef struct {
+    MpscNode node;
+    Dispatcher* dispatcher;
+    long id;
+} DispatchNode;
+
+static void dispatcher_mark(void* ptr) {
+    Dispatcher* dispatcher = (Dispatcher*)ptr;
+    rb_gc_mark(dispatcher->registry);
+    rb_gc_mark(dispatcher->thread);
+}
+
+// Intentionally never freed: driver callbacks may still push onto a
+// dispatcher after its Ractor has terminated
+static void dispatcher_free(void* ptr) {
+}
+
+static const struct rb_ractor_local_storage_type dispatcher_storage_type = {
+    dispatcher_mark,
+    dispatcher_free
+};
+
+static rb_ractor_local_key_t dispatcher_key;
+
+static Dispatcher* dispatcher_current(void) {
+    Dispatcher* dispatcher = (Dispatcher*)rb_ractor_local_storage_ptr(dispatcher_key);
+    if (dispatcher != NULL) {
+        return dispatcher;
+    }
+
+    dispatcher = malloc(sizeof(Dispatcher));
+    if (dispatcher == NULL) {
+        rb_raise(rb_eNoMemError, "failed to allocate future dispatcher");
+    }
+    dispatcher->pending.head = NULL;
+    pthread_mutex_init(&dispatcher->lock, NULL);
+    pthread_cond_init(&dispatcher->cond, NULL);
+    dispatcher->signaled = 0;
+    dispatcher->interrupted = 0;
+    dispatcher->registry = Qnil;
+    dispatcher->thread = Qnil;
+    dispatcher->next_id = 0;
+    rb_ractor_local_storage_ptr_set(dispatcher_key, dispatcher);
+    dispatcher->registry = rb_hash_new();
+    return dispatcher;
+}
+
+// Runs on a driver IO thread: must not touch any Ruby objects
+static void dispatch_listener(void* data) {
+    DispatchNode* node = (DispatchNode*)data;
+    Dispatcher* dispatcher = node->dispatcher;
+    if (mpsc_push(&dispatcher->pending, &node->node)) {
+        pthread_mutex_lock(&dispatcher->lock);
+        dispatcher->signaled = 1;
+        pthread_cond_signal(&dispatcher->cond);
+        pthread_mutex_unlock(&dispatcher->lock);
+    }
+}
+
+static void* dispatch_wait_nogvl(void* ptr) {
+    Dispatcher* dispatcher = (Dispatcher*)ptr;
+    pthread_mutex_lock(&dispatcher->lock);
+    while (!dispatcher->signaled && !dispatcher->interrupted) {
+        pthread_cond_wait(&dispatcher->cond, &dispatcher->lock);
+    }
+    dispatcher->signaled = 0;
+    pthread_mutex_unlock(&dispatcher->lock);
+    return NULL;
+}
+
+static void dispatch_ubf(void* ptr) {
+    Dispatcher* dispatcher = (Dispatcher*)ptr;
+    pthread_mutex_lock(&dispatcher->lock);
+    dispatcher->interrupted = 1;
+    pthread_cond_signal(&dispatcher->cond);
+    pthread_mutex_unlock(&dispatcher->lock);
+}
+
+typedef struct {
+    VALUE callback;
+    VALUE value;
+} CallbackArgs;
+
+static VALUE dispatch_call(VALUE ptr) {
+    CallbackArgs* args = (CallbackArgs*)ptr;
+    return rb_proc_call(args->callback, rb_ary_new_from_args(1, args->value));
+}
+
+static void future_settle_stage(VALUE self);
+
+static void dispatch_future(VALUE self) {
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+
+    VALUE callbacks = wrapper->callbacks;
+    wrapper->callbacks = Qnil;
+    wrapper->dispatch_pending = 0;
+    if (NIL_P(callbacks)) {
+        return;
+    }
+
+    // Only resolved for Ruby callbacks: continuations read the driver future
+    CallbackArgs args;
+    args.value = Qundef;
+    int failed = 0;
+
+    for (long i = 0; i < RARRAY_LEN(callbacks); i++) {
+        VALUE entry = RARRAY_AREF(callbacks, i);
+        int type = FIX2INT(RARRAY_AREF(entry, 0));
+        if (type == CALLBACK_CONTINUE) {
+            future_settle_stage(RARRAY_AREF(entry, 1));
+            continue;
+        }
+
+        if (args.value == Qundef) {
+            args.value = future_value(self);
+            failed = RTEST(rb_obj_is_kind_of(args.value, rb_eException));
+        }
+        if ((type == CALLBACK_ON_SUCCESS && failed) || (type == CALLBACK_ON_FAILURE && !failed)) {
+            continue;
+        }
+
+        // A raising callback must not take the dispatcher down with it
+        int state = 0;
+        args.callback = RARRAY_AREF(entry, 1);
+        rb_protect(dispatch_call, (VALUE)&args, &state);
+        if (state) {
+            VALUE error = rb_errinfo();
+            if (!RTEST(rb_obj_is_kind_of(error, rb_eException))) {
+                // Thread#kill or throw: let the dispatcher thread unwind
+                rb_jump_tag(state);
+            }
+            rb_set_errinfo(Qnil);
+            rb_warn("CassandraC future callback raised %" PRIsVALUE ": %" PRIsVALUE,
+                    rb_obj_class(error), rb_funcall(error, rb_intern("message"), 0));
+        }
+    }
+}
+
+typedef struct {
+    Dispatcher* dispatcher;
+    long id;
+} DispatchArgs;
+
+static VALUE dispatch_registered(VALUE ptr) {
+    DispatchArgs* args = (DispatchArgs*)ptr;
+    VALUE future = rb_hash_delete(args->dispatcher->registry, LONG2NUM(args->id));
+    if (!NIL_P(future)) {
+        dispatch_future(future);
+    }
+    return Qnil;
+}
+
+// Hand the undispatched rest of a batch back to the pending stack, and leave
+// the dispatcher signaled so the thread that replaces this one drains it
+static void dispatch_requeue(Dispatcher* dispatcher, MpscNode* node) {
+    while (node != NULL) {
+        MpscNode* next = node->next;
+        mpsc_push(&dispatcher->pending, node);
+        node = next;
+    }
+    pthread_mutex_lock(&dispatcher->lock);
+    dispatcher->signaled = 1;
+    pthread_cond_signal(&dispatcher->cond);
+    pthread_mutex_unlock(&dispatcher->lock);
+}
+
+static VALUE dispatch_loop(void* ptr) {
+    Dispatcher* dispatcher = (Dispatcher*)ptr;
+    for (;;) {
+        pthread_mutex_lock(&dispatcher->lock);
+        dispatcher->interrupted = 0;
+        pthread_mutex_unlock(&dispatcher->lock);
+        rb_thread_call_without_gvl(dispatch_wait_nogvl, dispatcher, dispatch_ubf, dispatcher);
+        rb_thread_check_ints();
+
+        // Resolving a value or settling a chained future can raise too; one
+        // future's failure must not strand the rest of the batch
+        MpscNode* node = mpsc_drain(&dispatcher->pending);
+        while (node != NULL) {
+            DispatchNode* dispatch = (DispatchNode*)node;
+            DispatchArgs args = {dispatcher, dispatch->id};
+            node = node->next;
+            free(dispatch);
+
+            int state = 0;
+            rb_protect(dispatch_registered, (VALUE)&args, &state);
+            if (state) {
+                VALUE error = rb_errinfo();
+                if (!RTEST(rb_obj_is_kind_of(error, rb_eException))) {
+                    dispatch_requeue(dispatcher, node);
+                    rb_jump_tag(state);
+                }
+                rb_set_errinfo(Qnil);
+                rb_warn("CassandraC future dispatch raised %" PRIsVALUE ": %" PRIsVALUE,
+                        rb_obj_class(error), rb_funcall(error, rb_intern("message"), 0));
+            }
+        }
+    }
+    return Qnil;
+}
+
+// Start the dispatcher on first use, and again if it died (e.g. after fork)
+static Dispatcher* dispatch_ensure_thread(void) {
+    Dispatcher* dispatcher = dispatcher_current();
+    if (!NIL_P(dispatcher->thread) && RTEST(rb_funcall(dispatcher->thread, rb_intern("alive?"), 0))) {
+        return dispatcher;
+    }
+    dispatcher->thread = rb_thread_create(dispatch_loop, dispatcher);
+    rb_funcall(dispatcher->thread, rb_intern("name="), 1, rb_str_new_cstr("cassandra_c-dispatch"));
+    return dispatcher;
+}
+
+// Queue the future's callbacks for the dispatcher: once its driver future
+// completes, or straight away if it settled without one
+static void future_register_dispatch(VALUE self, FutureWrapper* wrapper) {
+    Dispatcher* dispatcher = dispatch_ensure_thread();
+    if (wrapper->future != NULL && wrapper->completion == NULL) {
+        wrapper->completion = future_completion_new(wrapper->future);
+    }
+
+    DispatchNode* node = malloc(sizeof(DispatchNode));
+    if (node == NULL) {
+        rb_raise(rb_eNoMemError, "failed to allocate future dispatch node");
+    }
+    node->dispatcher = dispatcher;
+    node->id = dispatcher->next_id++;
+    rb_hash_aset(dispatcher->registry, LONG2NUM(node->id), self);
+    wrapper->dispatch_pending = 1;
+
+    if (wrapper->future == NULL) {
+        dispatch_listener(node);
+    } else {
+        // Runs immediately (pushing to the dispatcher) if already completed
+        future_completion_listen(wrapper->completion, dispatch_listener, node);
+    }
+}
+
+static void future_push_callback(VALUE self, int type, VALUE callable) {
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    if (wrapper->released) {
+        rb_raise(rb_eCassandraError, "Future has been released");
+    }
+    if (wrapper->cancelled && type != CALLBACK_CONTINUE) {
+        rb_raise(rb_eCassandraError, "Future was cancelled");
+    }
+    if (wrapper->future == NULL && wrapper->value == Qundef && NIL_P(wrapper->upstream)) {
+        rb_raise(rb_eCassandraError, "Future is NULL");
+    }
+
+    if (NIL_P(wrapper->callbacks)) {
+        wrapper->callbacks = rb_ary_new();
+    }
+    rb_ary_push(wrapper->callbacks, rb_ary_new_from_args(2, INT2FIX(type), callable));
+
+    // A chained future still waiting on its upstream registers once it settles
+    if (!wrapper->dispatch_pending && NIL_P(wrapper->upstream)) {
+        future_register_dispatch(self, wrapper);
+    }
+}
+
+static VALUE future_add_callback(VALUE self, int type) {
+    rb_need_block();
+    future_push_callback(self, type, rb_block_proc());
     return self;
 }
 
-// Wait for the Future to complete with a timeout
+// Call the block with the Result/Prepared/nil, or a CassandraC::Error on failure
+static VALUE future_on_complete(VALUE self) {
+    return future_add_callback(self, CALLBACK_ON_COMPLETE);
+}
+
+// Call the block with the value only if the future succeeded
+static VALUE future_on_success(VALUE self) {
+    return future_add_callback(self, CALLBACK_ON_SUCCESS);
+}
+
+// Call the block with a CassandraC::Error only if the future failed
+static VALUE future_on_failure(VALUE self) {
+    return future_add_callback(self, CALLBACK_ON_FAILURE);
+}
+
+// ============================================================================
+// Chaining
+// ============================================================================
+
+// A chained future has no driver future of its own until its upstream future
+// completes. The upstream's dispatcher then settles it in C: binding the
+// prepared statement, starting the execution, or running a Ruby block. A
+// thread waiting on the chained future settles it itself if it gets there
+// first. Failures propagate down the chain as CassandraC::Error values.
+
+// Attach a driver future to a chained future (or a driver future created later)
+void future_attach(VALUE self, CassFuture* future, FutureKind kind) {
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    wrapper->future = future;
+    wrapper->kind = kind;
+    if (!NIL_P(wrapper->callbacks) && !wrapper->dispatch_pending) {
+        future_register_dispatch(self, wrapper);
+    }
+}
+
+// The settled value of a completed future: a Result, Prepared, Statement, a
+// block's return value, or a CassandraC::Error (returned, not raised)
+VALUE future_value(VALUE self) {
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    if (wrapper->value != Qundef) {
+        return wrapper->value;
+    }
+    if (wrapper->future == NULL) {
+        rb_raise(rb_eCassandraError, "Future is NULL");
+    }
+    return future_adopt_metadata(wrapper, future_resolve_value(wrapper->future, wrapper->kind));
+}
+
+// A Statement for the upstream future's prepared statement, bound to `params`
+// (nil binds nothing). Uses the driver future directly when possible so no
+// Prepared object is created.
+static VALUE future_stage_bind(VALUE upstream, VALUE params) {
+    FutureWrapper* upstream_wrapper;
+    TypedData_Get_Struct(upstream, FutureWrapper, &future_type, upstream_wrapper);
+
+    CassStatement* statement;
+    VALUE prepared_value = Qnil;
+    if (upstream_wrapper->value == Qundef && upstream_wrapper->future != NULL &&
+        upstream_wrapper->kind == FUTURE_KIND_PREPARED &&
+        cass_future_error_code(upstream_wrapper->future) == CASS_OK) {
+        const CassPrepared* prepared = cass_future_get_prepared(upstream_wrapper->future);
+        statement = cass_prepared_bind(prepared);
+        cass_prepared_free(prepared);
+    } else {
+        VALUE value = future_value(upstream);
+        if (RTEST(rb_obj_is_kind_of(value, rb_eException))) {
+            return value;
+        }
+        if (!rb_obj_is_kind_of(value, cCassPrepared)) {
+            rb_raise(rb_eTypeError, "Expected the upstream future to resolve to a Prepared, got %s",
+                     rb_obj_classname(value));
+        }
+        PreparedWrapper* prepared_wrapper;
+        TypedData_Get_Struct(value, PreparedWrapper, &prepared_type, prepared_wrapper);
+        statement = cass_prepared_bind(prepared_wrapper->prepared);
+        prepared_value = value;
+    }
+    if (statement == NULL) {
+        rb_raise(rb_eCassandraError, "Failed to bind prepared statement");
+    }
+
+    // Owned by Ruby right away so a raising conversion cannot leak it
+    VALUE rb_statement = statement_new(statement);
+    StatementWrapper* statement_wrapper;
+    TypedData_Get_Struct(rb_statement, StatementWrapper, &statement_type, statement_wrapper);
+    statement_wrapper->prepared = prepared_value;
+    if (!NIL_P(params)) {
+        long failed_index;
+        CassError error = bind_positional_params(statement, params, &failed_index);
+        if (error != CASS_OK) {
+            rb_raise(rb_eCassandraError, "Failed to bind parameter at index %ld: %s",
+                     failed_index, cass_error_desc(error));
+        }
+    }
+    return rb_statement;
+}
+
+static VALUE future_run_stage(VALUE self) {
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    VALUE upstream = wrapper->upstream;
+
+    switch (wrapper->stage) {
+        case FUTURE_STAGE_BIND:
+            return future_stage_bind(upstream, wrapper->argument);
+
+        case FUTURE_STAGE_EXECUTE: {
+            FutureWrapper* upstream_wrapper;
+            TypedData_Get_Struct(upstream, FutureWrapper, &future_type, upstream_wrapper);
+            VALUE statement = upstream_wrapper->kind == FUTURE_KIND_PREPARED ? future_stage_bind(upstream, Qnil)
+                                                                             : future_value(upstream);
+            if (RTEST(rb_obj_is_kind_of(statement, rb_eException))) {
+                return statement;
+            }
+            if (rb_obj_is_kind_of(statement, cCassPrepared)) {
+                statement = future_stage_bind(upstream, Qnil);
+            } else if (!rb_obj_is_kind_of(statement, cCassStatement)) {
+                rb_raise(rb_eTypeError, "Expected the upstream future to resolve to a Statement, got %s",
+                         rb_obj_classname(statement));
+            }
+            StatementWrapper* statement_wrapper = statement_get(statement);
+            session_execute_into(wrapper->argument, statement_wrapper, self);
+            wrapper->prepared = statement_wrapper->prepared;
+            RB_GC_GUARD(statement);
+            return Qundef;
+        }
+
+        case FUTURE_STAGE_THEN: {
+            VALUE value = future_value(upstream);
+            if (RTEST(rb_obj_is_kind_of(value, rb_eException))) {
+                return value;
+            }
+            return rb_proc_call(wrapper->argument, rb_ary_new_from_args(1, value));
+        }
+
+        default:
+            return Qundef;
+    }
+}
+
+// Settle a chained future whose upstream has completed. Safe to call more than
+// once and from any thread holding the GVL; only the first call does the work.
+static void future_settle_stage(VALUE self) {
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    if (NIL_P(wrapper->upstream) || wrapper->settling) {
+        return;
+    }
+
+    wrapper->settling = 1;
+    int state = 0;
+    VALUE value = rb_protect(future_run_stage, self, &state);
+    wrapper->settling = 0;
+    wrapper->upstream = Qnil;
+    wrapper->argument = Qnil;
+
+    if (state) {
+        VALUE error = rb_errinfo();
+        if (!RTEST(rb_obj_is_kind_of(error, rb_eStandardError))) {
+            if (!wrapper->cancelled) {
+                wrapper->value = rb_exc_new_cstr(rb_eCassandraError, "Future chain was interrupted");
+            }
+            rb_jump_tag(state);
+        }
+        rb_set_errinfo(Qnil);
+        value = error;
+    }
+    if (wrapper->cancelled) {
+        // Cancelled while the stage ran: keep the cancellation and let go of
+        // any request the stage started
+        if (wrapper->future != NULL && wrapper->waiters == 0) {
+            future_detach(wrapper);
+        }
+    } else if (value != Qundef) {
+        wrapper->value = value;
+    }
+
+    // Settled without a driver future: run any callbacks registered meanwhile
+    if (wrapper->value != Qundef && !NIL_P(wrapper->callbacks) && !wrapper->dispatch_pending) {
+        future_register_dispatch(self, wrapper);
+    }
+}
+
+static cass_bool_t future_wait_until(VALUE self, cass_int64_t deadline_us);
+
+typedef struct {
+    FutureWrapper* wrapper;
+    cass_int64_t timeout_us;
+    cass_bool_t completed;
+} FutureWaitCall;
+
+static VALUE future_wait_call(VALUE ptr) {
+    FutureWaitCall* call = (FutureWaitCall*)ptr;
+    call->completed = future_wait_internal(call->wrapper->future, &call->wrapper->completion,
+                                           call->timeout_us, 0);
+    return Qnil;
+}
+
+static VALUE future_wait_call_done(VALUE ptr) {
+    FutureWrapper* wrapper = (FutureWrapper*)ptr;
+    wrapper->waiters--;
+    // The last waiter out finishes a cancellation that happened meanwhile
+    if (wrapper->cancelled && wrapper->waiters == 0 && wrapper->future != NULL) {
+        future_detach(wrapper);
+    }
+    return Qnil;
+}
+
+// Settle every chained future up to and including `self`, waiting for the
+// upstream futures until the deadline. Returns cass_false on timeout.
+static cass_bool_t future_settle_until(VALUE self, cass_int64_t deadline_us) {
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+
+    while (!NIL_P(wrapper->upstream)) {
+        if (deadline_us != FUTURE_WAIT_FOREVER && monotonic_us() >= deadline_us) {
+            return cass_false;
+        }
+        if (wrapper->settling) {
+            // Another thread is running this stage's block
+            rb_thread_wait_for(rb_time_interval(rb_float_new(0.001)));
+            continue;
+        }
+        if (!future_wait_until(wrapper->upstream, deadline_us)) {
+            return cass_false;
+        }
+        future_settle_stage(self);
+    }
+    return cass_true;
+}
+
+// Wait for `self` (settling chained futures on the way) until the deadline
+static cass_bool_t future_wait_until(VALUE self, cass_int64_t deadline_us) {
+    if (!future_settle_until(self, deadline_us)) {
+        return cass_false;
+    }
+
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    if (wrapper->value != Qundef) {
+        return cass_true;
+    }
+    if (wrapper->future == NULL) {
+        rb_raise(rb_eCassandraError, "Future is NULL");
+    }
+
+    FutureWaitCall call;
+    call.wrapper = wrapper;
+    call.timeout_us = FUTURE_WAIT_FOREVER;
+    call.completed = cass_false;
+    if (deadline_us != FUTURE_WAIT_FOREVER) {
+        call.timeout_us = deadline_us - monotonic_us();
+        if (call.timeout_us < 0) {
+            call.timeout_us = 0;
+        }
+    }
+
+    // Counted so Future#cancel never frees the driver future under a waiter
+    wrapper->waiters++;
+    rb_ensure(future_wait_call, (VALUE)&call, future_wait_call_done, (VALUE)wrapper);
+    return call.completed;
+}
+
+// Settle a chained future if its upstream has already completed; never blocks.
+// Returns 1 once the future has no pending upstream.
+static int future_try_settle(VALUE self) {
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    if (NIL_P(wrapper->upstream)) {
+        return 1;
+    }
+    if (wrapper->settling || !future_is_ready(wrapper->upstream)) {
+        return 0;
+    }
+    future_settle_stage(self);
+    return NIL_P(wrapper->upstream);
+}
+
+static VALUE future_chain(VALUE self, FutureStage stage, VALUE argument) {
+    VALUE next = future_allocate(cCassFuture);
+    FutureWrapper* next_wrapper;
+    TypedData_Get_Struct(next, FutureWrapper, &future_type, next_wrapper);
+    next_wrapper->stage = stage;
+    next_wrapper->upstream = self;
+    next_wrapper->argument = argument;
+    next_wrapper->kind = FUTURE_KIND_RESULT;
+
+    future_push_callback(self, CALLBACK_CONTINUE, next);
+    return next;
+}
+
+// A future for the block's return value, called with this future's value once
+// it succeeds. Failures (and exceptions raised by the block) settle the
+// returned future with the error instead.
+static VALUE future_then(VALUE self) {
+    rb_need_block();
+    return future_chain(self, FUTURE_STAGE_THEN, rb_block_proc());
+}
+
+// A future for a Statement binding `params` to the prepared statement this
+// (prepare) future resolves to
+static VALUE future_then_bind(int argc, VALUE* argv, VALUE self) {
+    VALUE params;
+    rb_scan_args(argc, argv, "01", &params);
+    if (!NIL_P(params)) {
+        Check_Type(params, T_ARRAY);
+        params = rb_ary_dup(params);
+    }
+    return future_chain(self, FUTURE_STAGE_BIND, params);
+}
+
+// A future for the Result of executing this future's Statement (or its
+// Prepared, bound without parameters) on `session`
+static VALUE future_then_execute(VALUE self, VALUE session) {
+    rb_check_typeddata(session, &session_type);
+    return future_chain(self, FUTURE_STAGE_EXECUTE, session);
+}
+
+// Whether the future has completed (settling it first if it is chained)
+int future_is_ready(VALUE self) {
+    if (!future_try_settle(self)) {
+        return 0;
+    }
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    if (wrapper->value != Qundef) {
+        return 1;
+    }
+    if (wrapper->future == NULL) {
+        rb_raise(rb_eCassandraError, "Future is NULL");
+    }
+    return cass_future_ready(wrapper->future) ? 1 : 0;
+}
+
+static FutureWrapper* future_live_wrapper(VALUE self) {
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    if (wrapper->released) {
+        rb_raise(rb_eCassandraError, "Future has been released");
+    }
+    if (wrapper->cancelled) {
+        rb_raise(rb_eCassandraError, "Future was cancelled");
+    }
+    return wrapper;
+}
+
+// Check if the Future is ready
+static VALUE future_ready(VALUE self) {
+    future_live_wrapper(self);
+    return future_is_ready(self) ? Qtrue : Qfalse;
+}
+
+// Wait for the Future to complete, or until its request deadline passes
+static VALUE future_wait(VALUE self) {
+    FutureWrapper* wrapper = future_live_wrapper(self);
+    future_wait_until(self, wrapper->deadline_us);
+    return self;
+}
+
+// Wait for the Future to complete with a timeout (in microseconds). Returns
+// false if the timeout or the request deadline passed first.
 static VALUE future_wait_timed(VALUE self, VALUE timeout) {
+    FutureWrapper* wrapper = future_live_wrapper(self);
+    cass_int64_t timeout_us = NUM2LL(timeout);
+    if (timeout_us < 0) {
+        rb_raise(rb_eArgError, "timeout must not be negative");
+    }
+    cass_int64_t deadline_us = monotonic_us() + timeout_us;
+    if (wrapper->deadline_us != FUTURE_WAIT_FOREVER && wrapper->deadline_us < deadline_us) {
+        deadline_us = wrapper->deadline_us;
+    }
+    cass_bool_t completed = future_wait_until(self, deadline_us);
+    return completed ? Qtrue : Qfalse;
+}
+
+// Wait for the Future (settling it if it is chained) and return its wrapper.
+// Raises if the request deadline passes first.
+static FutureWrapper* future_settled_wrapper(VALUE self) {
+    FutureWrapper* wrapper = future_live_wrapper(self);
+    if (!future_wait_until(self, wrapper->deadline_us)) {
+        rb_raise(rb_eCassandraError, "Request deadline exceeded");
+    }
+    if (wrapper->value == Qundef && wrapper->future == NULL) {
+        rb_raise(rb_eCassandraError, "Future is NULL");
+    }
+    return wrapper;
+}
+
+// Abandon the Future. Waits on it stop being possible and the driver future is
+// freed as soon as the driver completes it; the request itself keeps running
+// until it completes or its request timeout fires. Chained futures waiting on
+// this one settle with the cancellation error. Returns true if the request was
+// still pending.
+static VALUE future_cancel(VALUE self) {
     FutureWrapper* wrapper;
     TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
-    cass_bool_t timed_out = cass_future_wait_timed(wrapper->future, NUM2LL(timeout));
-    return timed_out ? Qfalse : Qtrue;
+    if (wrapper->cancelled) {
+        return Qfalse;
+    }
+
+    int pending = wrapper->value == Qundef &&
+                  (wrapper->future == NULL || !cass_future_ready(wrapper->future));
+    wrapper->cancelled = 1;
+    future_uncount(wrapper);
+    wrapper->value = rb_exc_new_cstr(rb_eCassandraError, "Future was cancelled");
+    wrapper->upstream = Qnil;
+    wrapper->argument = Qnil;
+    if (wrapper->future != NULL && wrapper->waiters == 0) {
+        future_detach(wrapper);
+    }
+
+    // Pending callbacks and continuations see the cancellation straight away
+    // unless they are already waiting on the driver future
+    if (!NIL_P(wrapper->callbacks) && !wrapper->dispatch_pending) {
+        future_register_dispatch(self, wrapper);
+    }
+    return pending ? Qtrue : Qfalse;
 }
 
-// Get the error code from the Future
-static VALUE future_error_code(VALUE self) {
+// Free the driver future, and with it its share of the result buffers, now
+// rather than when the Future is collected. The Future must have completed
+// (or been cancelled) and have no waiters or undelivered callbacks. Results
+// already fetched stay valid; any later use of the Future raises. Returns nil;
+// releasing twice is a no-op.
+static VALUE future_release(VALUE self) {
+    FutureWrapper* wrapper;
+    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    if (wrapper->released) {
+        return Qnil;
+    }
+    if (wrapper->waiters > 0 || wrapper->settling || wrapper->dispatch_pending) {
+        rb_raise(rb_eCassandraError, "Cannot release a Future that is in use");
+    }
+    if (!wrapper->cancelled && !future_is_ready(self)) {
+        rb_raise(rb_eCassandraError, "Cannot release a pending Future; wait for or cancel it first");
+    }
+
+    if (wrapper->future != NULL) {
+        cass_future_free(wrapper->future);
+        wrapper->future = NULL;
+    }
+    if (wrapper->completion != NULL) {
+        future_completion_release(wrapper->completion);
+        wrapper->completion = NULL;
+    }
+    wrapper->released = 1;
+    wrapper->value = rb_exc_new_cstr(rb_eCassandraError, "Future has been released");
+    wrapper->callbacks = Qnil;
+    wrapper->upstream = Qnil;
+    wrapper->argument = Qnil;
+    wrapper->prepared = Qnil;
+    wrapper->session = Qnil;
+    wrapper->statement = Qnil;
+    future_uncount(wrapper);
+    return Qnil;
+}
+
+// Whether Future#cancel has been called
+static VALUE future_cancelled(VALUE self) {
     FutureWrapper* wrapper;
     TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    return wrapper->cancelled ? Qtrue : Qfalse;
+}
+
+// Get the error code from the Future. Chained futures that settled without a
+// driver future report CASS_OK on success and nil for a non-driver failure.
+static VALUE future_error_code(VALUE self) {
+    FutureWrapper* wrapper = future_settled_wrapper(self);
+    if (wrapper->value != Qundef) {
+        return RTEST(rb_obj_is_kind_of(wrapper->value, rb_eException)) ? Qnil : INT2NUM(CASS_OK);
+    }
     return INT2NUM(cass_future_error_code(wrapper->future));
 }
 
 // Get the error message from the Future
 static VALUE future_error_message(VALUE self) {
-    FutureWrapper* wrapper;
-    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    FutureWrapper* wrapper = future_settled_wrapper(self);
+    if (wrapper->value != Qundef) {
+        if (RTEST(rb_obj_is_kind_of(wrapper->value, rb_eException))) {
+            return rb_funcall(wrapper->value, rb_intern("message"), 0);
+        }
+        return rb_str_new_cstr("");
+    }
     const char* message;
     size_t message_length;
     cass_future_error_message(wrapper->future, &message, &message_length);
     return rb_str_new(message, message_length);
 }
 
+// Value of a future that settled without a driver future; raises failures
+static VALUE future_settled_value(FutureWrapper* wrapper) {
+    if (RTEST(rb_obj_is_kind_of(wrapper->value, rb_eException))) {
+        rb_exc_raise(wrapper->value);
+    }
+    return wrapper->value;
+}
+
 // Get the result from the Future
 static VALUE future_get_result(VALUE self) {
-    FutureWrapper* wrapper;
-    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    FutureWrapper* wrapper = future_settled_wrapper(self);
+    if (wrapper->value != Qundef) {
+        return future_settled_value(wrapper);
+    }
 
     if (cass_future_error_code(wrapper->future) != CASS_OK) {
         const char* error_message;
@@ -96,13 +1399,15 @@ static VALUE future_get_result(VALUE self) {
     }
 
     // Cast away const since we transfer ownership to Ruby's GC via result_new
-    return result_new((CassResult*)result);
+    return future_adopt_metadata(wrapper, result_new((CassResult*)result));
 }
 
 // Get the prepared statement from the Future
 static VALUE future_get_prepared(VALUE self) {
-    FutureWrapper* wrapper;
-    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    FutureWrapper* wrapper = future_settled_wrapper(self);
+    if (wrapper->value != Qundef) {
+        return future_settled_value(wrapper);
+    }
 
     if (cass_future_error_code(wrapper->future) != CASS_OK) {
         const char* error_message;
@@ -122,8 +1427,10 @@ static VALUE future_get_prepared(VALUE self) {
 
 // Get the tracing ID from the Future
 static VALUE future_tracing_id(VALUE self) {
-    FutureWrapper* wrapper;
-    TypedData_Get_Struct(self, FutureWrapper, &future_type, wrapper);
+    FutureWrapper* wrapper = future_settled_wrapper(self);
+    if (wrapper->future == NULL) {
+        return Qnil;
+    }
 
     CassUuid trace_id;
     CassError rc = cass_future_tracing_id(wrapper->future, &trace_id);
@@ -138,10 +1445,244 @@ static VALUE future_tracing_id(VALUE self) {
     return rb_str_new_cstr(uuid_str);
 }
 
+// ============================================================================
+// Multiplexed Waits
+// ============================================================================
+
+// Shared between a waiting Ruby thread and the completion listeners of every
+// future it waits on. Reference counted because listeners can still fire after
+// the waiter has given up on a timeout or interrupt.
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    long pending;       // Completions still needed before the waiter wakes
+    long first;         // Index of the first completed future, -1 until then
+    int refs;
+    int interrupted;
+    int timed;
+    struct timespec abstime;
+} FutureMultiWait;
+
+typedef struct {
+    FutureMultiWait* wait;
+    long index;
+} FutureMultiWaitNode;
+
+static void future_multi_wait_release(FutureMultiWait* wait) {
+    pthread_mutex_lock(&wait->lock);
+    int refs = --wait->refs;
+    pthread_mutex_unlock(&wait->lock);
+    if (refs == 0) {
+        pthread_cond_destroy(&wait->cond);
+        pthread_mutex_destroy(&wait->lock);
+        free(wait);
+    }
+}
+
+// Runs on a driver IO thread (or inline if already completed)
+static void future_multi_wait_listener(void* data) {
+    FutureMultiWaitNode* node = (FutureMultiWaitNode*)data;
+    FutureMultiWait* wait = node->wait;
+
+    pthread_mutex_lock(&wait->lock);
+    if (wait->first < 0) {
+        wait->first = node->index;
+    }
+    if (--wait->pending == 0) {
+        pthread_cond_signal(&wait->cond);
+    }
+    pthread_mutex_unlock(&wait->lock);
+
+    free(node);
+    future_multi_wait_release(wait);
+}
+
+static void* future_multi_wait_nogvl(void* ptr) {
+    FutureMultiWait* wait = (FutureMultiWait*)ptr;
+    pthread_mutex_lock(&wait->lock);
+    while (wait->pending > 0 && !wait->interrupted) {
+        if (wait->timed) {
+            if (pthread_cond_timedwait(&wait->cond, &wait->lock, &wait->abstime) == ETIMEDOUT) {
+                break;
+            }
+        } else {
+            pthread_cond_wait(&wait->cond, &wait->lock);
+        }
+    }
+    pthread_mutex_unlock(&wait->lock);
+    return NULL;
+}
+
+static void future_multi_wait_ubf(void* ptr) {
+    FutureMultiWait* wait = (FutureMultiWait*)ptr;
+    pthread_mutex_lock(&wait->lock);
+    wait->interrupted = 1;
+    pthread_cond_signal(&wait->cond);
+    pthread_mutex_unlock(&wait->lock);
+}
+
+// Block (without the GVL) until `needed` of the futures have completed or the
+// timeout elapses. Returns the index of the first completed future, or -1 on
+// timeout. A negative timeout_us waits forever.
+static long future_multi_wait(VALUE futures, long needed, cass_int64_t timeout_us) {
+    long count = RARRAY_LEN(futures);
+    cass_int64_t settle_deadline_us = timeout_us < 0 ? FUTURE_WAIT_FOREVER : monotonic_us() + timeout_us;
+    for (long i = 0; i < count; i++) {
+        // Chained futures are settled first so each has a driver future or a value
+        VALUE future = RARRAY_AREF(futures, i);
+        if (!future_settle_until(future, settle_deadline_us)) {
+            return -1;
+        }
+        FutureWrapper* wrapper;
+        TypedData_Get_Struct(future, FutureWrapper, &future_type, wrapper);
+        if (wrapper->future == NULL && wrapper->value == Qundef) {
+            rb_raise(rb_eCassandraError, "Future is NULL");
+        }
+    }
+    if (settle_deadline_us != FUTURE_WAIT_FOREVER) {
+        timeout_us = settle_deadline_us - monotonic_us();
+        if (timeout_us < 0) {
+            timeout_us = 0;
+        }
+    }
+
+    FutureMultiWait* wait = malloc(sizeof(FutureMultiWait));
+    if (wait == NULL) {
+        rb_raise(rb_eNoMemError, "failed to allocate future wait");
+    }
+    pthread_mutex_init(&wait->lock, NULL);
+    pthread_cond_init(&wait->cond, NULL);
+    wait->pending = needed;
+    wait->first = -1;
+    wait->refs = 1;
+    wait->interrupted = 0;
+    wait->timed = timeout_us >= 0;
+    cass_int64_t deadline_us = FUTURE_WAIT_FOREVER;
+    if (wait->timed) {
+        deadline_us = monotonic_us() + timeout_us;
+        clock_gettime(CLOCK_REALTIME, &wait->abstime);
+        cass_int64_t nsec = wait->abstime.tv_nsec + (timeout_us % 1000000) * 1000;
+        wait->abstime.tv_sec += (time_t)(timeout_us / 1000000 + nsec / 1000000000);
+        wait->abstime.tv_nsec = (long)(nsec % 1000000000);
+    }
+
+    for (long i = 0; i < count; i++) {
+        FutureWrapper* wrapper;
+        TypedData_Get_Struct(RARRAY_AREF(futures, i), FutureWrapper, &future_type, wrapper);
+        if (wrapper->future != NULL && wrapper->completion == NULL) {
+            wrapper->completion = future_completion_new(wrapper->future);
+        }
+
+        FutureMultiWaitNode* node = malloc(sizeof(FutureMultiWaitNode));
+        if (node == NULL) {
+            // Listeners already registered hold their own references
+            future_multi_wait_release(wait);
+            rb_raise(rb_eNoMemError, "failed to allocate future wait");
+        }
+        node->wait = wait;
+        node->index = i;
+        pthread_mutex_lock(&wait->lock);
+        wait->refs++;
+        pthread_mutex_unlock(&wait->lock);
+        if (wrapper->future == NULL) {
+            // Settled without a driver future: already complete
+            future_multi_wait_listener(node);
+        } else {
+            future_completion_listen(wrapper->completion, future_multi_wait_listener, node);
+        }
+    }
+
+    int done = 0;
+    long first = -1;
+    for (;;) {
+        pthread_mutex_lock(&wait->lock);
+        wait->interrupted = 0;
+        pthread_mutex_unlock(&wait->lock);
+
+        rb_thread_call_without_gvl(future_multi_wait_nogvl, wait, future_multi_wait_ubf, wait);
+
+        pthread_mutex_lock(&wait->lock);
+        done = wait->pending <= 0;
+        first = wait->first;
+        pthread_mutex_unlock(&wait->lock);
+
+        if (done || (deadline_us != FUTURE_WAIT_FOREVER && monotonic_us() >= deadline_us)) {
+            break;
+        }
+
+        int state = 0;
+        rb_protect(future_check_ints, Qnil, &state);
+        if (state) {
+            future_multi_wait_release(wait);
+            rb_jump_tag(state);
+        }
+    }
+
+    future_multi_wait_release(wait);
+    RB_GC_GUARD(futures);
+    return done ? first : -1;
+}
+
+// Parse the futures argument and `timeout:` option (in seconds) shared by
+// Future.wait_all and Future.wait_any
+static VALUE future_multi_wait_args(int argc, VALUE* argv, cass_int64_t* timeout_us) {
+    VALUE futures, options;
+    rb_scan_args(argc, argv, "11", &futures, &options);
+
+    *timeout_us = FUTURE_WAIT_FOREVER;
+    if (!NIL_P(options)) {
+        Check_Type(options, T_HASH);
+        VALUE timeout = rb_hash_aref(options, ID2SYM(rb_intern("timeout")));
+        if (!NIL_P(timeout)) {
+            double seconds = NUM2DBL(timeout);
+            if (seconds < 0) {
+                rb_raise(rb_eArgError, "timeout must not be negative");
+            }
+            *timeout_us = (cass_int64_t)(seconds * 1000000.0);
+        }
+    }
+
+    // Snapshot the list so it cannot change underneath the wait
+    return rb_ary_dup(rb_convert_type(futures, T_ARRAY, "Array", "to_ary"));
+}
+
+// Wait for every future at once. Returns their values in order (a Result,
+// Prepared or nil, with failures as CassandraC::Error instances), or nil if the
+// timeout elapsed first.
+static VALUE future_s_wait_all(int argc, VALUE* argv, VALUE klass) {
+    cass_int64_t timeout_us;
+    VALUE futures = future_multi_wait_args(argc, argv, &timeout_us);
+    long count = RARRAY_LEN(futures);
+
+    if (count > 0 && future_multi_wait(futures, count, timeout_us) < 0) {
+        return Qnil;
+    }
+
+    VALUE values = rb_ary_new_capa(count);
+    for (long i = 0; i < count; i++) {
+        rb_ary_push(values, future_value(RARRAY_AREF(futures, i)));
+    }
+    return values;
+}
+
+// Wait until any future completes and return it, or nil on timeout
+static VALUE future_s_wait_any(int argc, VALUE* argv, VALUE klass) {
+    cass_int64_t timeout_us;
+    VALUE futures = future_multi_wait_args(argc, argv, &timeout_us);
+
+    if (RARRAY_LEN(futures) == 0) {
+        return Qnil;
+    }
+    long first = future_multi_wait(futures, 1, timeout_us);
+    return first < 0 ? Qnil : RARRAY_AREF(futures, first);
+}
+
 // Initialize the Future class
 void Init_cassandra_c_future(VALUE module) {
     cCassFuture = rb_define_class_under(module, "Future", rb_cObject);
     rb_define_alloc_func(cCassFuture, future_allocate);
+    rb_define_singleton_method(cCassFuture, "wait_all", future_s_wait_all, -1);
+    rb_define_singleton_method(cCassFuture, "wait_any", future_s_wait_any, -1);
     rb_define_method(cCassFuture, "ready?", future_ready, 0);
     rb_define_method(cCassFuture, "wait", future_wait, 0);
     rb_define_method(cCassFuture, "wait_timed", future_wait_timed, 1);
@@ -150,4 +1691,15 @@ void Init_cassandra_c_future(VALUE module) {
     rb_define_method(cCassFuture, "get_result", future_get_result, 0);
     rb_define_method(cCassFuture, "get_prepared", future_get_prepared, 0);
     rb_define_method(cCassFuture, "tracing_id", future_tracing_id, 0);
+    rb_define_method(cCassFuture, "on_complete", future_on_complete, 0);
+    rb_define_method(cCassFuture, "on_success", future_on_success, 0);
+    rb_define_method(cCassFuture, "on_failure", future_on_failure, 0);
+    rb_define_method(cCassFuture, "then", future_then, 0);
+    rb_define_method(cCassFuture, "then_bind", future_then_bind, -1);
+    rb_define_method(cCassFuture, "then_execute", future_then_execute, 1);
+    rb_define_method(cCassFuture, "cancel", future_cancel, 0);
+    rb_define_method(cCassFuture, "cancelled?", future_cancelled, 0);
+    rb_define_method(cCassFuture, "release", future_release, 0);
+
+    dispatcher_key = rb_ractor_local_storage_ptr_newkey(&dispatcher_storage_type);
 }
\ No newline at end of file
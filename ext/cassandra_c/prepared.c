@@ -1,4 +1,5 @@
 #include "cassandra_c.h"
+#include "ruby/atomic.h"
 
 VALUE cCassPrepared;
 
@@ -9,24 +10,40 @@ static void prepared_free(void* ptr) {
         cass_prepared_free(wrapper->prepared);
     }
     xfree(wrapper);
+    native_handle_freed(NATIVE_PREPARED);
 }
 
-// Data type for Prepared
+static size_t prepared_memsize(const void* ptr) {
+    return sizeof(PreparedWrapper);
+}
+
+static void prepared_mark(void* ptr) {
+    PreparedWrapper* wrapper = (PreparedWrapper*)ptr;
+    rb_gc_mark(wrapper->result_metadata);
+}
+
+// Data type for Prepared. The prepared metadata is immutable, so a frozen
+// Prepared can be shared between Ractors; each binds its own statements. The
+// cached result metadata is itself shareable and only read and replaced
+// atomically (see prepared_result_metadata).
 const rb_data_type_t prepared_type = {
     .wrap_struct_name = "CassPrepared",
     .function = {
-        .dmark = NULL,
+        .dmark = prepared_mark,
         .dfree = prepared_free,
-        .dsize = NULL,
+        .dsize = prepared_memsize,
     },
     .data = NULL,
-    .flags = RUBY_TYPED_FREE_IMMEDIATELY
+    .flags = RUBY_TYPED_FREE_IMMEDIATELY | RUBY_TYPED_FROZEN_SHAREABLE
 };
 // Allocate function for Prepared
 static VALUE prepared_allocate(VALUE klass) {
     PreparedWrapper* wrapper = ALLOC(PreparedWrapper);
     wrapper->prepared = NULL;
-    return TypedData_Wrap_Struct(klass, &prepared_type, wrapper);
+    wrapper->result_metadata = Qnil;
+    VALUE rb_prepared = TypedData_Wrap_Struct(klass, &prepared_type, wrapper);
+    native_handle_created(NATIVE_PREPARED);
+    return rb_prepared;
 }
 
 VALUE prepared_new(const CassPrepared* prepared) {
@@ -37,6 +54,41 @@ VALUE prepared_new(const CassPrepared* prepared) {
     return rb_prepared;
 }
 
+// The result metadata cached on `prepared`, or nil. Results of a shared
+// Prepared can be created in several Ractors at once, so the cache is read and
+// published with atomics rather than a lock: building metadata allocates, and
+// nothing may block another Ractor's GC while doing so.
+VALUE prepared_result_metadata(VALUE prepared) {
+    PreparedWrapper* wrapper;
+    TypedData_Get_Struct(prepared, PreparedWrapper, &prepared_type, wrapper);
+    // A compare-and-swap of Qundef for Qundef is an atomic load
+    return (VALUE)RUBY_ATOMIC_VALUE_CAS(wrapper->result_metadata, Qundef, Qundef);
+}
+
+// Replace the cached result metadata `expected` (as returned by
+// prepared_result_metadata) with `metadata`. If another Result replaced it
+// first, that one is kept; the caller can still use its own.
+void prepared_publish_result_metadata(VALUE prepared, VALUE expected, VALUE metadata) {
+    PreparedWrapper* wrapper;
+    TypedData_Get_Struct(prepared, PreparedWrapper, &prepared_type, wrapper);
+    RUBY_ATOMIC_VALUE_CAS(wrapper->result_metadata, expected, metadata);
+}
+
+// Bind each element of `params` by position. Returns the first error, with
+// the offending index in *failed_index; the statement is left to the caller.
+CassError bind_positional_params(CassStatement* statement, VALUE params, long* failed_index) {
+    long param_count = RARRAY_LEN(params);
+    for (long i = 0; i < param_count; i++) {
+        VALUE param = rb_ary_entry(params, i);
+        CassError error = ruby_value_to_cass_statement(statement, (size_t)i, param);
+        if (error != CASS_OK) {
+            *failed_index = i;
+            return error;
+        }
+    }
+    return CASS_OK;
+}
+
 // Bind method - creates a statement from this prepared statement
 static VALUE prepared_bind(int argc, VALUE* argv, VALUE self) {
     VALUE params;
@@ -61,23 +113,36 @@ static VALUE prepared_bind(int argc, VALUE* argv, VALUE self) {
             rb_raise(rb_eArgError, "Parameters must be an array");
         }
         
-        long param_count = RARRAY_LEN(params);
-        for (long i = 0; i < param_count; i++) {
-            VALUE param = rb_ary_entry(params, i);
-            CassError error = ruby_value_to_cass_statement(statement, (size_t)i, param);
-            if (error != CASS_OK) {
-                cass_statement_free(statement);
-                rb_raise(rb_eCassandraError, "Failed to bind parameter at index %ld: %s", 
-                         i, cass_error_desc(error));
-            }
+        long failed_index;
+        CassError error = bind_positional_params(statement, params, &failed_index);
+        if (error != CASS_OK) {
+            cass_statement_free(statement);
+            rb_raise(rb_eCassandraError, "Failed to bind parameter at index %ld: %s", 
+                     failed_index, cass_error_desc(error));
         }
     }
     
-    return statement_new(statement);
+    VALUE rb_statement = statement_new(statement);
+    StatementWrapper* statement_wrapper;
+    TypedData_Get_Struct(rb_statement, StatementWrapper, &statement_type, statement_wrapper);
+    statement_wrapper->prepared = self;
+    return rb_statement;
+}
+
+// Columns of the statement's results: a frozen Array of frozen Hashes with
+// :name, :type and, for collections, :subtypes. Taken from the first Result
+// the statement produced, so nil until it has been executed.
+static VALUE prepared_result_columns(VALUE self) {
+    VALUE metadata = prepared_result_metadata(self);
+    if (NIL_P(metadata)) {
+        return Qnil;
+    }
+    return result_metadata_columns(metadata);
 }
 
 void Init_cassandra_c_prepared(VALUE module) {
     cCassPrepared = rb_define_class_under(module, "Prepared", rb_cObject);
     rb_define_alloc_func(cCassPrepared, prepared_allocate);
     rb_define_method(cCassPrepared, "bind", prepared_bind, -1);
+    rb_define_method(cCassPrepared, "result_columns", prepared_result_columns, 0);
 }
@@ -1,32 +1,269 @@
 #include "cassandra_c.h"
+#include "ruby/encoding.h"
+#include "ruby/ractor.h"
+#include <stdint.h>
+#include <string.h>
 
 VALUE cCassResult;
 
-// Memory management for Result
-static void result_free(void* ptr) {
+// ============================================================================
+// Result Metadata
+// ============================================================================
+
+// Column names, types and decoders of a result. Results of a prepared
+// statement share one instance through the Prepared, so names and decoders are
+// built once rather than per Result. Immutable and Ractor-shareable.
+typedef struct {
+    size_t column_count;
+    CassValueType* types;
+    ValueDecoderFn* decoders;
+    VALUE names;            // Frozen Array of frozen, interned UTF-8 Strings
+    VALUE symbols;          // Frozen Array of Symbols
+    VALUE columns;          // Prepared#result_columns
+} ResultMetadata;
+
+static void result_metadata_mark(void* ptr) {
+    ResultMetadata* metadata = (ResultMetadata*)ptr;
+    rb_gc_mark(metadata->names);
+    rb_gc_mark(metadata->symbols);
+    rb_gc_mark(metadata->columns);
+}
+
+static void result_metadata_free(void* ptr) {
+    ResultMetadata* metadata = (ResultMetadata*)ptr;
+    xfree(metadata->types);
+    xfree(metadata->decoders);
+    xfree(metadata);
+}
+
+static size_t result_metadata_memsize(const void* ptr) {
+    const ResultMetadata* metadata = (const ResultMetadata*)ptr;
+    return sizeof(ResultMetadata) + (metadata->column_count + 1) * (sizeof(CassValueType) + sizeof(ValueDecoderFn));
+}
+
+static const rb_data_type_t result_metadata_type = {
+    .wrap_struct_name = "CassResultMetadata",
+    .function = {
+        .dmark = result_metadata_mark,
+        .dfree = result_metadata_free,
+        .dsize = result_metadata_memsize,
+    },
+    .data = NULL,
+    .flags = RUBY_TYPED_FREE_IMMEDIATELY | RUBY_TYPED_FROZEN_SHAREABLE
+};
+
+static VALUE result_metadata_subtypes(const CassDataType* data_type) {
+    size_t count = cass_data_type_sub_type_count(data_type);
+    VALUE subtypes = rb_ary_new_capa((long)count);
+    for (size_t i = 0; i < count; i++) {
+        const CassDataType* sub_type = cass_data_type_sub_data_type(data_type, i);
+        rb_ary_push(subtypes, cass_value_type_symbol(cass_data_type_type(sub_type)));
+    }
+    return subtypes;
+}
+
+static VALUE result_metadata_new(const CassResult* result) {
+    ResultMetadata* metadata;
+    VALUE self = TypedData_Make_Struct(rb_cObject, ResultMetadata, &result_metadata_type, metadata);
+    size_t column_count = cass_result_column_count(result);
+    metadata->column_count = column_count;
+    metadata->types = ALLOC_N(CassValueType, column_count + 1);
+    metadata->decoders = ALLOC_N(ValueDecoderFn, column_count + 1);
+    metadata->names = rb_ary_new_capa((long)column_count);
+    metadata->symbols = rb_ary_new_capa((long)column_count);
+    metadata->columns = rb_ary_new_capa((long)column_count);
+
+    VALUE sym_name = ID2SYM(rb_intern("name"));
+    VALUE sym_type = ID2SYM(rb_intern("type"));
+    VALUE sym_subtypes = ID2SYM(rb_intern("subtypes"));
+    for (size_t i = 0; i < column_count; i++) {
+        const char* column_name;
+        size_t column_name_length;
+        cass_result_column_name(result, i, &column_name, &column_name_length);
+        VALUE name = rb_enc_interned_str(column_name, (long)column_name_length, rb_utf8_encoding());
+        CassValueType type = cass_result_column_type(result, i);
+
+        metadata->types[i] = type;
+        metadata->decoders[i] = value_decoder_for(type);
+        rb_ary_push(metadata->names, name);
+        rb_ary_push(metadata->symbols, rb_to_symbol(name));
+
+        VALUE column = rb_hash_new();
+        rb_hash_aset(column, sym_name, name);
+        rb_hash_aset(column, sym_type, cass_value_type_symbol(type));
+        const CassDataType* data_type = cass_result_column_data_type(result, i);
+        if (data_type != NULL && cass_data_type_sub_type_count(data_type) > 0) {
+            rb_hash_aset(column, sym_subtypes, result_metadata_subtypes(data_type));
+        }
+        rb_ary_push(metadata->columns, column);
+    }
+
+    return rb_ractor_make_shareable(self);
+}
+
+// Whether `result` still has the columns `metadata` describes; a schema change
+// can alter a prepared statement's columns
+static int result_metadata_matches(const ResultMetadata* metadata, const CassResult* result) {
+    if (cass_result_column_count(result) != metadata->column_count) {
+        return 0;
+    }
+    for (size_t i = 0; i < metadata->column_count; i++) {
+        const char* column_name;
+        size_t column_name_length;
+        cass_result_column_name(result, i, &column_name, &column_name_length);
+        VALUE name = RARRAY_AREF(metadata->names, (long)i);
+        if (cass_result_column_type(result, i) != metadata->types[i] ||
+            (size_t)RSTRING_LEN(name) != column_name_length ||
+            memcmp(RSTRING_PTR(name), column_name, column_name_length) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static ResultMetadata* result_metadata_get(VALUE metadata) {
+    ResultMetadata* data;
+    TypedData_Get_Struct(metadata, ResultMetadata, &result_metadata_type, data);
+    return data;
+}
+
+// Use the metadata cached on `prepared` for `result`, (re)building it from the
+// result when there is none yet or the columns have changed
+void result_use_prepared_metadata(VALUE self, VALUE prepared) {
+    ResultWrapper* wrapper = result_get(self);
+
+    VALUE cached = prepared_result_metadata(prepared);
+    VALUE metadata = cached;
+    if (NIL_P(metadata) || !result_metadata_matches(result_metadata_get(metadata), wrapper->result)) {
+        metadata = result_metadata_new(wrapper->result);
+        prepared_publish_result_metadata(prepared, cached, metadata);
+    }
+    wrapper->metadata = metadata;
+    RB_GC_GUARD(cached);
+}
+
+VALUE result_metadata_columns(VALUE metadata) {
+    return result_metadata_get(metadata)->columns;
+}
+
+// ============================================================================
+// Result Class
+// ============================================================================
+
+static void result_mark(void* ptr) {
     ResultWrapper* wrapper = (ResultWrapper*)ptr;
+    rb_gc_mark(wrapper->metadata);
+    rb_gc_mark(wrapper->session);
+    rb_gc_mark(wrapper->statement);
+    rb_gc_mark(wrapper->views);
+}
+
+// Free the CassResult and everything derived from it
+static void result_release(ResultWrapper* wrapper) {
+    if (wrapper->cursor != NULL) {
+        cass_iterator_free(wrapper->cursor);
+        wrapper->cursor = NULL;
+    }
+    xfree(wrapper->decoders);
+    wrapper->decoders = NULL;
+    xfree(wrapper->custom_decoders);
+    wrapper->custom_decoders = NULL;
+    xfree(wrapper->intern_mask);
+    wrapper->intern_mask = NULL;
     if (wrapper->result != NULL) {
         cass_result_free(wrapper->result);
+        wrapper->result = NULL;
+        native_handle_freed(NATIVE_RESULTS);
     }
+    native_memory_adjust(-(ssize_t)wrapper->payload_size);
+    wrapper->payload_size = 0;
+}
+
+// Memory management for Result
+static void result_free(void* ptr) {
+    ResultWrapper* wrapper = (ResultWrapper*)ptr;
+    result_release(wrapper);
     xfree(wrapper);
 }
 
+// Row data the driver holds for `result`: every cell's bytes plus its 4-byte
+// length prefix. The driver keeps the whole response frame until the result
+// is freed, so this approximates the frame size. Every row is summed, since
+// one row says little about variable-length columns; only cell lengths are
+// read, nothing is decoded into Ruby objects.
+static size_t result_payload_size(const CassResult* result) {
+    size_t column_count = cass_result_column_count(result);
+    size_t size = cass_result_row_count(result) * column_count * sizeof(cass_int32_t);
+    if (column_count == 0) {
+        return size;
+    }
+
+    CassIterator* rows = cass_iterator_from_result(result);
+    while (cass_iterator_next(rows)) {
+        const CassRow* row = cass_iterator_get_row(rows);
+        for (size_t i = 0; i < column_count; i++) {
+            const cass_byte_t* bytes;
+            size_t length;
+            if (cass_value_get_bytes(cass_row_get_column(row, i), &bytes, &length) == CASS_OK) {
+                size += length;
+            }
+        }
+    }
+    cass_iterator_free(rows);
+    return size;
+}
+
+static size_t result_memsize(const void* ptr) {
+    const ResultWrapper* wrapper = (const ResultWrapper*)ptr;
+    size_t size = sizeof(ResultWrapper) + wrapper->payload_size;
+    if (wrapper->result != NULL) {
+        size_t column_count = cass_result_column_count(wrapper->result) + 1;
+        if (wrapper->decoders != NULL) size += column_count * sizeof(ValueDecoderFn);
+        if (wrapper->custom_decoders != NULL) size += column_count * sizeof(ValueDecoderFn);
+        if (wrapper->intern_mask != NULL) size += column_count;
+    }
+    return size;
+}
+
 // Data type for Future
 const rb_data_type_t result_type = {
     .wrap_struct_name = "CassResult",
     .function = {
-        .dmark = NULL,
+        .dmark = result_mark,
         .dfree = result_free,
-        .dsize = NULL,
+        .dsize = result_memsize,
     },
     .data = NULL,
     .flags = RUBY_TYPED_FREE_IMMEDIATELY
 };
 
+// The wrapper of a Result whose CassResult has not been freed
+ResultWrapper* result_get(VALUE self) {
+    ResultWrapper* wrapper;
+    TypedData_Get_Struct(self, ResultWrapper, &result_type, wrapper);
+    if (wrapper->result == NULL) {
+        rb_raise(rb_eCassandraError, "Result has been freed");
+    }
+    return wrapper;
+}
+
 // Allocate function for Result
 static VALUE result_allocate(VALUE klass) {
     ResultWrapper* wrapper = ALLOC(ResultWrapper);
     wrapper->result = NULL;
+    wrapper->decoders = NULL;
+    wrapper->custom_decoders = NULL;
+    wrapper->binary_ids = 0;
+    wrapper->intern_mask = NULL;
+    wrapper->blob_views = 0;
+    wrapper->session = Qnil;
+    wrapper->statement = Qnil;
+    wrapper->metadata = Qnil;
+    wrapper->cursor = NULL;
+    wrapper->cursor_next = 0;
+    wrapper->payload_size = 0;
+    wrapper->views = Qnil;
+    wrapper->iterating = 0;
     return TypedData_Wrap_Struct(klass, &result_type, wrapper);
 }
 
@@ -39,7 +276,18 @@ static VALUE result_initialize(VALUE self, VALUE wrapped_result) {
         rb_raise(rb_eTypeError, "wrapped_result must be a CassResult pointer");
     }
     
+    if (wrapper->result != NULL) {
+        rb_raise(rb_eCassandraError, "Result is already initialized");
+    }
     wrapper->result = (CassResult*)NUM2ULL(wrapped_result);
+    if (wrapper->result != NULL) {
+        native_handle_created(NATIVE_RESULTS);
+
+        // Let the GC see the driver's row data so large results are collected
+        // promptly
+        wrapper->payload_size = result_payload_size(wrapper->result);
+        native_memory_adjust((ssize_t)wrapper->payload_size);
+    }
     return self;
 }
 
@@ -51,8 +299,7 @@ VALUE result_new(CassResult* result) {
 
 // Get the row count
 static VALUE result_row_count(VALUE self) {
-    ResultWrapper* wrapper;
-    TypedData_Get_Struct(self, ResultWrapper, &result_type, wrapper);
+    ResultWrapper* wrapper = result_get(self);
     
     size_t count = cass_result_row_count(wrapper->result);
     return ULONG2NUM(count);
@@ -60,8 +307,7 @@ static VALUE result_row_count(VALUE self) {
 
 // Get the column count
 static VALUE result_column_count(VALUE self) {
-    ResultWrapper* wrapper;
-    TypedData_Get_Struct(self, ResultWrapper, &result_type, wrapper);
+    ResultWrapper* wrapper = result_get(self);
     
     size_t count = cass_result_column_count(wrapper->result);
     return ULONG2NUM(count);
@@ -69,70 +315,628 @@ static VALUE result_column_count(VALUE self) {
 
 // Check if the result has more pages
 static VALUE result_has_more_pages(VALUE self) {
-    ResultWrapper* wrapper;
-    TypedData_Get_Struct(self, ResultWrapper, &result_type, wrapper);
+    ResultWrapper* wrapper = result_get(self);
     
     cass_bool_t has_more = cass_result_has_more_pages(wrapper->result);
     return has_more ? Qtrue : Qfalse;
 }
 
-// Get column names
-static VALUE result_column_names(VALUE self) {
-    ResultWrapper* wrapper;
-    TypedData_Get_Struct(self, ResultWrapper, &result_type, wrapper);
-    
-    // Check for cached value in instance variable
-    VALUE column_names = rb_iv_get(self, "@column_names");
-    if (NIL_P(column_names)) {
+// The opaque token for resuming after this page, as a binary String, or nil
+// on the last page
+static VALUE result_paging_state(VALUE self) {
+    ResultWrapper* wrapper = result_get(self);
+
+    if (!cass_result_has_more_pages(wrapper->result)) {
+        return Qnil;
+    }
+
+    const char* token;
+    size_t token_length;
+    CassError error = cass_result_paging_state_token(wrapper->result, &token, &token_length);
+    if (error != CASS_OK) {
+        rb_raise(rb_eCassandraError, "Failed to get paging state: %s", cass_error_desc(error));
+    }
+    return rb_str_new(token, token_length);
+}
+
+// Per-column decoders, resolved from the column types on first use
+static ValueDecoderFn* result_text_decoders(ResultWrapper* wrapper) {
+    if (!NIL_P(wrapper->metadata)) {
+        return result_metadata_get(wrapper->metadata)->decoders;
+    }
+    if (wrapper->decoders == NULL) {
         size_t column_count = cass_result_column_count(wrapper->result);
-        column_names = rb_ary_new_capa(column_count);
-        
+        ValueDecoderFn* decoders = ALLOC_N(ValueDecoderFn, column_count + 1);
         for (size_t i = 0; i < column_count; i++) {
-            const char* column_name;
-            size_t column_name_length;
-            cass_result_column_name(wrapper->result, i, &column_name, &column_name_length);
-            rb_ary_push(column_names, rb_str_new(column_name, column_name_length));
+            decoders[i] = value_decoder_for(cass_result_column_type(wrapper->result, i));
         }
-        
-        // Cache the column names
-        rb_iv_set(self, "@column_names", column_names);
+        wrapper->decoders = decoders;
     }
-    
-    return column_names;
+    return wrapper->decoders;
+}
+
+// Decoders for the Result's current options (see binary_ids= and
+// intern_columns=), falling back to the plain per-column decoders
+ValueDecoderFn* result_decoders(VALUE self) {
+    ResultWrapper* wrapper = result_get(self);
+    if (wrapper->custom_decoders != NULL) {
+        return wrapper->custom_decoders;
+    }
+    return result_text_decoders(wrapper);
+}
+
+// Rebuild the Result's own decoder table after an option changes. The table is
+// updated in place and lives until the Result is freed, so changing options
+// while iterating is safe.
+static void result_customize_decoders(ResultWrapper* wrapper) {
+    ValueDecoderFn* decoders = result_text_decoders(wrapper);
+    size_t column_count = cass_result_column_count(wrapper->result);
+    if (wrapper->custom_decoders == NULL) {
+        wrapper->custom_decoders = ALLOC_N(ValueDecoderFn, column_count + 1);
+    }
+    for (size_t i = 0; i < column_count; i++) {
+        CassValueType type = cass_result_column_type(wrapper->result, i);
+        ValueDecoderFn decoder = decoders[i];
+        if (wrapper->binary_ids && value_binary_decoder_for(type) != NULL) {
+            decoder = value_binary_decoder_for(type);
+        }
+        if (wrapper->intern_mask != NULL && wrapper->intern_mask[i]) {
+            decoder = value_interned_decoder_for(type);
+        }
+        if (wrapper->blob_views && type == CASS_VALUE_TYPE_BLOB) {
+            decoder = value_blob_view;
+        }
+        wrapper->custom_decoders[i] = decoder;
+    }
+}
+
+// Decode UUID, TimeUUID and inet columns as frozen binary Strings (16 bytes
+// for UUIDs, 4 or 16 for addresses) instead of formatted text. Values nested
+// in collections keep their usual form.
+static VALUE result_set_binary_ids(VALUE self, VALUE enabled) {
+    ResultWrapper* wrapper = result_get(self);
+    wrapper->binary_ids = RTEST(enabled);
+    result_customize_decoders(wrapper);
+    return enabled;
+}
+
+static VALUE result_binary_ids(VALUE self) {
+    ResultWrapper* wrapper = result_get(self);
+    return wrapper->binary_ids ? Qtrue : Qfalse;
 }
 
+// Decode blob columns as :string (copied, the default) or :buffer, read-only
+// IO::Buffer views into the Result's memory that keep the Result alive
+static VALUE result_set_blobs(VALUE self, VALUE mode) {
+    ResultWrapper* wrapper = result_get(self);
+
+    if (mode == ID2SYM(rb_intern("buffer"))) {
+        if (!value_blob_views_supported()) {
+            rb_raise(rb_eNotImpError, "Blob views require IO::Buffer (Ruby 3.1+)");
+        }
+        wrapper->blob_views = 1;
+    } else if (mode == ID2SYM(rb_intern("string"))) {
+        wrapper->blob_views = 0;
+    } else {
+        rb_raise(rb_eArgError, "blobs must be :string or :buffer");
+    }
+    result_customize_decoders(wrapper);
+    return mode;
+}
+
+static VALUE result_blobs(VALUE self) {
+    ResultWrapper* wrapper = result_get(self);
+    return ID2SYM(rb_intern(wrapper->blob_views ? "buffer" : "string"));
+}
+
+// Hidden instance variable tying a blob view to the Result owning its memory
+static ID id_view_owner;
+static ID id_aset;
+static ID id_keys;
+static VALUE cWeakMap;  // ObjectSpace::WeakMap
+
+// Decode one cell of this Result with the given column decoder
+VALUE result_decode_cell(VALUE self, ValueDecoderFn decoder, const CassValue* value) {
+    VALUE decoded = cass_value_decode(decoder, value);
+    if (decoder == value_blob_view && !NIL_P(decoded)) {
+        // Views are released by Result#free, since they point into its rows.
+        // They are tracked weakly, so views already collected are not kept.
+        ResultWrapper* wrapper = result_get(self);
+        if (NIL_P(wrapper->views)) {
+            wrapper->views = rb_class_new_instance(0, NULL, cWeakMap);
+        }
+        rb_funcall(wrapper->views, id_aset, 2, decoded, Qtrue);
+        rb_ivar_set(decoded, id_view_owner, self);
+    }
+    return decoded;
+}
+
+static VALUE result_rows(VALUE self, VALUE keys, long column, VALUE collected);
+
 // Implement the each method for Enumerable support
 static VALUE result_each(VALUE self) {
     RETURN_ENUMERATOR(self, 0, 0);  // Return enumerator if no block given
-    
+    return result_rows(self, Qnil, -1, Qnil);
+}
+
+// Hash keys for the result's columns: frozen, interned UTF-8 Strings or, with
+// `symbolize`, Symbols. Built once per Result and reused for every row.
+static VALUE result_hash_keys(VALUE self, ResultWrapper* wrapper, int symbolize) {
+    if (!NIL_P(wrapper->metadata)) {
+        ResultMetadata* metadata = result_metadata_get(wrapper->metadata);
+        return symbolize ? metadata->symbols : metadata->names;
+    }
+
+    const char* ivar = symbolize ? "@column_symbols" : "@column_keys";
+    VALUE keys = rb_iv_get(self, ivar);
+    if (!NIL_P(keys)) {
+        return keys;
+    }
+
+    size_t column_count = cass_result_column_count(wrapper->result);
+    keys = rb_ary_new_capa((long)column_count);
+    for (size_t i = 0; i < column_count; i++) {
+        const char* column_name;
+        size_t column_name_length;
+        cass_result_column_name(wrapper->result, i, &column_name, &column_name_length);
+        if (symbolize) {
+            rb_ary_push(keys, ID2SYM(rb_intern3(column_name, (long)column_name_length, rb_utf8_encoding())));
+        } else {
+            rb_ary_push(keys, rb_enc_interned_str(column_name, (long)column_name_length, rb_utf8_encoding()));
+        }
+    }
+    rb_obj_freeze(keys);
+    rb_iv_set(self, ivar, keys);
+    return keys;
+}
+
+// Column names as a frozen Array of frozen UTF-8 Strings, the same Array as
+// each_hash's keys. Results of a prepared statement share theirs.
+static VALUE result_column_names(VALUE self) {
+    return result_hash_keys(self, result_get(self), 0);
+}
+
+// The `keys:` option: :string (the default) or :symbol
+static int result_symbolize_option(VALUE keys) {
+    if (NIL_P(keys) || keys == ID2SYM(rb_intern("string"))) {
+        return 0;
+    }
+    if (keys == ID2SYM(rb_intern("symbol"))) {
+        return 1;
+    }
+    rb_raise(rb_eArgError, "keys must be :string or :symbol");
+}
+
+// Build a Hash for one row from the shared keys, inserting all pairs at once.
+// `pairs` has room for two entries per column.
+static VALUE result_row_hash(VALUE self, const CassRow* row, const ValueDecoderFn* decoders, VALUE keys,
+                             size_t column_count, VALUE* pairs) {
+    for (size_t i = 0; i < column_count; i++) {
+        pairs[2 * i] = RARRAY_AREF(keys, (long)i);
+        pairs[2 * i + 1] = result_decode_cell(self, decoders[i], cass_row_get_column(row, i));
+    }
+    VALUE hash = rb_hash_new();
+    rb_hash_bulk_insert((long)(2 * column_count), pairs, hash);
+    return hash;
+}
+
+typedef struct {
+    VALUE self;
     ResultWrapper* wrapper;
-    TypedData_Get_Struct(self, ResultWrapper, &result_type, wrapper);
-    
+    VALUE keys;             // Hash keys, or nil to collect value Arrays
+    long column;            // Collect only this column's values, or -1
+    VALUE collected;        // Array to collect into, or nil to yield
+    CassIterator* rows;
+} ResultRowsArgs;
+
+static VALUE result_rows_body(VALUE ptr) {
+    ResultRowsArgs* args = (ResultRowsArgs*)ptr;
+    size_t column_count = cass_result_column_count(args->wrapper->result);
+    const ValueDecoderFn* decoders = result_decoders(args->self);
+
+    // Values (or key/value pairs) of the current row, so each row is built
+    // with a single allocation
+    VALUE buffer;
+    VALUE* values = ALLOCV_N(VALUE, buffer, 2 * column_count + 1);
+    while (cass_iterator_next(args->rows)) {
+        const CassRow* row = cass_iterator_get_row(args->rows);
+
+        VALUE value;
+        if (args->column >= 0) {
+            value = result_decode_cell(args->self, decoders[args->column], cass_row_get_column(row, (size_t)args->column));
+        } else if (NIL_P(args->keys)) {
+            for (size_t i = 0; i < column_count; i++) {
+                values[i] = result_decode_cell(args->self, decoders[i], cass_row_get_column(row, i));
+            }
+            value = rb_ary_new_from_values((long)column_count, values);
+        } else {
+            value = result_row_hash(args->self, row, decoders, args->keys, column_count, values);
+        }
+
+        if (NIL_P(args->collected)) {
+            rb_yield(value);
+        } else {
+            rb_ary_push(args->collected, value);
+        }
+    }
+    ALLOCV_END(buffer);
+    return Qnil;
+}
+
+static VALUE result_rows_cleanup(VALUE ptr) {
+    ResultRowsArgs* args = (ResultRowsArgs*)ptr;
+    cass_iterator_free(args->rows);
+    args->wrapper->iterating--;
+    return Qnil;
+}
+
+// Yield (or collect) every row as an Array, as a Hash when `keys` is given,
+// or as the value of a single `column`.
+// The iterator is freed even if the block breaks out or raises.
+static VALUE result_rows(VALUE self, VALUE keys, long column, VALUE collected) {
+    ResultRowsArgs args;
+    args.wrapper = result_get(self);
+    args.self = self;
+    args.keys = keys;
+    args.column = column;
+    args.collected = collected;
+    args.rows = cass_iterator_from_result(args.wrapper->result);
+    args.wrapper->iterating++;
+    rb_ensure(result_rows_body, (VALUE)&args, result_rows_cleanup, (VALUE)&args);
+    return NIL_P(collected) ? self : collected;
+}
+
+// Yield each row as a Hash of column name => value. keys: :symbol uses Symbol
+// keys; String keys are frozen and shared by every row.
+static VALUE result_each_hash(int argc, VALUE* argv, VALUE self) {
+    RETURN_SIZED_ENUMERATOR(self, argc, argv, 0);
+
+    VALUE options;
+    rb_scan_args(argc, argv, ":", &options);
+    VALUE keys_option = NIL_P(options) ? Qnil : rb_hash_aref(options, ID2SYM(rb_intern("keys")));
+
+    ResultWrapper* wrapper = result_get(self);
+    VALUE keys = result_hash_keys(self, wrapper, result_symbolize_option(keys_option));
+    return result_rows(self, keys, -1, Qnil);
+}
+
+// All rows as Arrays of values, or with as: :hash as Hashes (see each_hash)
+static VALUE result_to_a(int argc, VALUE* argv, VALUE self) {
+    VALUE options;
+    rb_scan_args(argc, argv, ":", &options);
+
+    VALUE as = Qnil;
+    VALUE keys_option = Qnil;
+    if (!NIL_P(options)) {
+        as = rb_hash_aref(options, ID2SYM(rb_intern("as")));
+        keys_option = rb_hash_aref(options, ID2SYM(rb_intern("keys")));
+    }
+
+    ResultWrapper* wrapper = result_get(self);
+    VALUE collected = rb_ary_new_capa((long)cass_result_row_count(wrapper->result));
+
+    if (NIL_P(as) || as == ID2SYM(rb_intern("array"))) {
+        return result_rows(self, Qnil, -1, collected);
+    }
+    if (as == ID2SYM(rb_intern("hash"))) {
+        VALUE keys = result_hash_keys(self, wrapper, result_symbolize_option(keys_option));
+        return result_rows(self, keys, -1, collected);
+    }
+    rb_raise(rb_eArgError, "as must be :array or :hash");
+}
+
+// Index of the column named `name` (a String or Symbol), or -1 if there is none
+long result_column_index_by_name(VALUE self, VALUE name) {
+    ResultWrapper* wrapper = result_get(self);
+
+    if (SYMBOL_P(name)) {
+        name = rb_sym2str(name);
+    }
+    StringValue(name);
+
     size_t column_count = cass_result_column_count(wrapper->result);
-    
-    // Iterate through each row
-    CassIterator* rows_iterator = cass_iterator_from_result(wrapper->result);
-    while (cass_iterator_next(rows_iterator)) {
-        const CassRow* row = cass_iterator_get_row(rows_iterator);
-        
-        // Create an array for this row's values
-        VALUE row_array = rb_ary_new_capa(column_count);
-        
-        // Extract each column value
+    for (size_t i = 0; i < column_count; i++) {
+        const char* column_name;
+        size_t column_name_length;
+        cass_result_column_name(wrapper->result, i, &column_name, &column_name_length);
+        if (column_name_length == (size_t)RSTRING_LEN(name) &&
+            memcmp(column_name, RSTRING_PTR(name), column_name_length) == 0) {
+            return (long)i;
+        }
+    }
+    return -1;
+}
+
+// Resolve a column index (negative counts from the end) or name; raises
+// IndexError if the result has no such column
+static size_t result_column_arg(VALUE self, ResultWrapper* wrapper, VALUE key) {
+    long column_count = (long)cass_result_column_count(wrapper->result);
+    long index;
+    if (RB_INTEGER_TYPE_P(key)) {
+        index = NUM2LONG(key);
+        if (index < 0) {
+            index += column_count;
+        }
+    } else {
+        index = result_column_index_by_name(self, key);
+    }
+
+    if (index < 0 || index >= column_count) {
+        rb_raise(rb_eIndexError, "No such column: %" PRIsVALUE, rb_inspect(key));
+    }
+    return (size_t)index;
+}
+
+// Decode the given text columns (names or indexes; true for every text column,
+// nil or false for none) as frozen, interned Strings. Suits low-cardinality
+// columns such as statuses or country codes, where every row would otherwise
+// allocate its own copy of the same few values.
+static VALUE result_set_intern_columns(VALUE self, VALUE columns) {
+    ResultWrapper* wrapper = result_get(self);
+    size_t column_count = cass_result_column_count(wrapper->result);
+
+    // Column lookups may raise, so the selection is built in a GC-owned buffer
+    VALUE selected = rb_str_new(NULL, (long)column_count);
+    char* flags = RSTRING_PTR(selected);
+    memset(flags, 0, column_count);
+    if (columns == Qtrue) {
         for (size_t i = 0; i < column_count; i++) {
-            const CassValue* value = cass_row_get_column(row, i);
-            rb_ary_push(row_array, cass_value_to_ruby(value));
+            flags[i] = value_interned_decoder_for(cass_result_column_type(wrapper->result, i)) != NULL;
+        }
+    } else if (RTEST(columns)) {
+        Check_Type(columns, T_ARRAY);
+        for (long i = 0; i < RARRAY_LEN(columns); i++) {
+            VALUE column = RARRAY_AREF(columns, i);
+            size_t index = result_column_arg(self, wrapper, column);
+            if (value_interned_decoder_for(cass_result_column_type(wrapper->result, index)) == NULL) {
+                rb_raise(rb_eArgError, "Column %" PRIsVALUE " is not a text column", rb_inspect(column));
+            }
+            flags[index] = 1;
         }
-        
-        // Yield the array of values to the block
-        rb_yield(row_array);
     }
-    
-    cass_iterator_free(rows_iterator);
-    
+
+    if (wrapper->intern_mask == NULL) {
+        wrapper->intern_mask = ALLOC_N(char, column_count + 1);
+    }
+    memcpy(wrapper->intern_mask, flags, column_count);
+    RB_GC_GUARD(selected);
+    result_customize_decoders(wrapper);
+    return columns;
+}
+
+// All values of one column, by index or name
+static VALUE result_column(VALUE self, VALUE key) {
+    ResultWrapper* wrapper = result_get(self);
+    size_t column = result_column_arg(self, wrapper, key);
+
+    VALUE values = rb_ary_new_capa((long)cass_result_row_count(wrapper->result));
+    return result_rows(self, Qnil, (long)column, values);
+}
+
+// Read-only IO::Buffer over a String, which is frozen rather than copied
+static VALUE result_buffer_for(VALUE string) {
+    VALUE buffer_class = rb_const_get(rb_cIO, rb_intern("Buffer"));
+    return rb_funcall(buffer_class, rb_intern("for"), 1, rb_obj_freeze(string));
+}
+
+// One column of a numeric type packed into binary Strings: `data` holds a
+// native-endian 64-bit value per row (int64 for integer types and timestamps
+// in milliseconds, double for float and double) and `nulls` a bitmap with one
+// bit per row, least significant bit first, set where the value is null. Null
+// rows hold 0 in `data`. Returns [data, nulls]; with `as: :buffer` both are
+// read-only IO::Buffers over the packed bytes instead.
+static VALUE result_packed_column(int argc, VALUE* argv, VALUE self) {
+    VALUE key, options;
+    rb_scan_args(argc, argv, "1:", &key, &options);
+
+    int as_buffer = 0;
+    VALUE as = NIL_P(options) ? Qnil : rb_hash_aref(options, ID2SYM(rb_intern("as")));
+    if (as == ID2SYM(rb_intern("buffer"))) {
+        if (!value_blob_views_supported()) {
+            rb_raise(rb_eNotImpError, "Packed buffers require IO::Buffer (Ruby 3.1+)");
+        }
+        as_buffer = 1;
+    } else if (!NIL_P(as) && as != ID2SYM(rb_intern("string"))) {
+        rb_raise(rb_eArgError, "as must be :string or :buffer");
+    }
+
+    ResultWrapper* wrapper = result_get(self);
+    size_t column = result_column_arg(self, wrapper, key);
+
+    CassValueType type = cass_result_column_type(wrapper->result, column);
+    switch (type) {
+        case CASS_VALUE_TYPE_TINY_INT:
+        case CASS_VALUE_TYPE_SMALL_INT:
+        case CASS_VALUE_TYPE_INT:
+        case CASS_VALUE_TYPE_BIGINT:
+        case CASS_VALUE_TYPE_COUNTER:
+        case CASS_VALUE_TYPE_TIMESTAMP:
+        case CASS_VALUE_TYPE_FLOAT:
+        case CASS_VALUE_TYPE_DOUBLE:
+            break;
+        default:
+            rb_raise(rb_eTypeError, "Column %" PRIsVALUE " is not of a packable numeric type", rb_inspect(key));
+    }
+
+    size_t row_count = cass_result_row_count(wrapper->result);
+    VALUE data = rb_str_new(NULL, (long)(row_count * 8));
+    VALUE nulls = rb_str_new(NULL, (long)((row_count + 7) / 8));
+    unsigned char* bitmap = (unsigned char*)RSTRING_PTR(nulls);
+    char* out = RSTRING_PTR(data);
+    memset(bitmap, 0, (size_t)RSTRING_LEN(nulls));
+
+    // No Ruby calls below, so nothing can raise while the iterator is live
+    CassIterator* rows = cass_iterator_from_result(wrapper->result);
+    for (size_t i = 0; i < row_count && cass_iterator_next(rows); i++) {
+        const CassValue* value = cass_row_get_column(cass_iterator_get_row(rows), column);
+        int64_t integer = 0;
+        double real = 0.0;
+
+        if (value == NULL || cass_value_is_null(value)) {
+            bitmap[i / 8] |= (unsigned char)(1u << (i % 8));
+        } else {
+            switch (type) {
+                case CASS_VALUE_TYPE_TINY_INT: {
+                    cass_int8_t i8;
+                    cass_value_get_int8(value, &i8);
+                    integer = i8;
+                    break;
+                }
+                case CASS_VALUE_TYPE_SMALL_INT: {
+                    cass_int16_t i16;
+                    cass_value_get_int16(value, &i16);
+                    integer = i16;
+                    break;
+                }
+                case CASS_VALUE_TYPE_INT: {
+                    cass_int32_t i32;
+                    cass_value_get_int32(value, &i32);
+                    integer = i32;
+                    break;
+                }
+                case CASS_VALUE_TYPE_FLOAT: {
+                    cass_float_t f;
+                    cass_value_get_float(value, &f);
+                    real = f;
+                    break;
+                }
+                case CASS_VALUE_TYPE_DOUBLE:
+                    cass_value_get_double(value, &real);
+                    break;
+                default: {
+                    cass_int64_t i64;
+                    cass_value_get_int64(value, &i64);
+                    integer = i64;
+                    break;
+                }
+            }
+        }
+
+        if (type == CASS_VALUE_TYPE_FLOAT || type == CASS_VALUE_TYPE_DOUBLE) {
+            memcpy(out + i * 8, &real, 8);
+        } else {
+            memcpy(out + i * 8, &integer, 8);
+        }
+    }
+    cass_iterator_free(rows);
+
+    if (as_buffer) {
+        return rb_ary_new_from_args(2, result_buffer_for(data), result_buffer_for(nulls));
+    }
+    return rb_ary_new_from_args(2, data, nulls);
+}
+
+// Row `index` of the result, read through the result's cursor. The returned
+// row is only valid until the cursor moves again. Rows read in order (as
+// each_row yields them) cost one iterator advance each; reading an earlier
+// row restarts the cursor.
+const CassRow* result_row_at(VALUE self, size_t index) {
+    ResultWrapper* wrapper = result_get(self);
+
+    if (wrapper->cursor != NULL && wrapper->cursor_next > index + 1) {
+        cass_iterator_free(wrapper->cursor);
+        wrapper->cursor = NULL;
+    }
+    if (wrapper->cursor == NULL) {
+        wrapper->cursor = cass_iterator_from_result(wrapper->result);
+        wrapper->cursor_next = 0;
+    }
+    while (wrapper->cursor_next <= index) {
+        if (!cass_iterator_next(wrapper->cursor)) {
+            rb_raise(rb_eIndexError, "row %zu is out of range", index);
+        }
+        wrapper->cursor_next++;
+    }
+    return cass_iterator_get_row(wrapper->cursor);
+}
+
+// Read-only IO::Buffer over one blob cell, without copying it; nil for null.
+// The buffer keeps this Result alive.
+static VALUE result_blob_view(VALUE self, VALUE row_index, VALUE column) {
+    ResultWrapper* wrapper = result_get(self);
+
+    size_t index = result_column_arg(self, wrapper, column);
+    if (cass_result_column_type(wrapper->result, index) != CASS_VALUE_TYPE_BLOB) {
+        rb_raise(rb_eTypeError, "Column %" PRIsVALUE " is not a blob column", rb_inspect(column));
+    }
+    long row = NUM2LONG(row_index);
+    if (row < 0) {
+        row += (long)cass_result_row_count(wrapper->result);
+    }
+    if (row < 0) {
+        rb_raise(rb_eIndexError, "row %ld is out of range", NUM2LONG(row_index));
+    }
+    return result_decode_cell(self, value_blob_view, cass_row_get_column(result_row_at(self, (size_t)row), index));
+}
+
+// Remember the Session and Statement that produced this Result, so its
+// following pages can be fetched
+void result_set_source(VALUE self, VALUE session, VALUE statement) {
+    ResultWrapper* wrapper = result_get(self);
+    wrapper->session = session;
+    wrapper->statement = statement;
+}
+
+// Yield the rows of this page and of every following page. Each next page is
+// requested before the current one is yielded, so only two pages are held at
+// once and the round trip overlaps with processing.
+static VALUE result_each_across_pages(VALUE self) {
+    RETURN_ENUMERATOR(self, 0, 0);  // Return enumerator if no block given
+
+    ResultWrapper* wrapper = result_get(self);
+    if (NIL_P(wrapper->session)) {
+        if (cass_result_has_more_pages(wrapper->result)) {
+            rb_raise(rb_eCassandraError, "Result has more pages but was not executed from a Statement");
+        }
+        return result_rows(self, Qnil, -1, Qnil);
+    }
+    session_each_page_from(wrapper->session, wrapper->statement, self, 1);
     return self;
 }
 
+// Yield a Row for each row. Columns are decoded only when read.
+static VALUE result_each_row(VALUE self) {
+    RETURN_ENUMERATOR(self, 0, 0);  // Return enumerator if no block given
+
+    ResultWrapper* wrapper = result_get(self);
+
+    size_t row_count = cass_result_row_count(wrapper->result);
+    size_t column_count = cass_result_column_count(wrapper->result);
+    for (size_t i = 0; i < row_count; i++) {
+        rb_yield(row_new(self, i, column_count));
+    }
+
+    return self;
+}
+
+// Free the CassResult now rather than when the Result is collected. Blob views
+// into its rows are released too; any later use of the Result raises. Rows
+// already decoded stay valid. Returns nil; freeing twice is a no-op.
+VALUE result_free_now(VALUE self) {
+    ResultWrapper* wrapper;
+    TypedData_Get_Struct(self, ResultWrapper, &result_type, wrapper);
+    if (wrapper->iterating > 0) {
+        rb_raise(rb_eCassandraError, "Cannot free a Result while iterating over it");
+    }
+
+    if (!NIL_P(wrapper->views)) {
+        VALUE views = rb_funcall(wrapper->views, id_keys, 0);
+        for (long i = 0; i < RARRAY_LEN(views); i++) {
+            value_blob_view_release(RARRAY_AREF(views, i));
+        }
+        wrapper->views = Qnil;
+    }
+    result_release(wrapper);
+    return Qnil;
+}
+
+// Whether Result#free has been called
+static VALUE result_freed(VALUE self) {
+    ResultWrapper* wrapper;
+    TypedData_Get_Struct(self, ResultWrapper, &result_type, wrapper);
+    return wrapper->result == NULL ? Qtrue : Qfalse;
+}
+
 // Initialize the Result class
 void Init_cassandra_c_result(VALUE module) {
     cCassResult = rb_define_class_under(module, "Result", rb_cObject);
@@ -141,9 +945,29 @@ void Init_cassandra_c_result(VALUE module) {
     rb_define_method(cCassResult, "row_count", result_row_count, 0);
     rb_define_method(cCassResult, "column_count", result_column_count, 0);
     rb_define_method(cCassResult, "has_more_pages?", result_has_more_pages, 0);
+    rb_define_method(cCassResult, "paging_state", result_paging_state, 0);
     rb_define_method(cCassResult, "column_names", result_column_names, 0);
+    rb_define_method(cCassResult, "binary_ids=", result_set_binary_ids, 1);
+    rb_define_method(cCassResult, "binary_ids?", result_binary_ids, 0);
+    rb_define_method(cCassResult, "intern_columns=", result_set_intern_columns, 1);
+    rb_define_method(cCassResult, "blobs=", result_set_blobs, 1);
+    rb_define_method(cCassResult, "blobs", result_blobs, 0);
+    rb_define_method(cCassResult, "blob_view", result_blob_view, 2);
     rb_define_method(cCassResult, "each", result_each, 0);
+    rb_define_method(cCassResult, "each_row", result_each_row, 0);
+    rb_define_method(cCassResult, "each_across_pages", result_each_across_pages, 0);
+    rb_define_method(cCassResult, "each_hash", result_each_hash, -1);
+    rb_define_method(cCassResult, "to_a", result_to_a, -1);
+    rb_define_method(cCassResult, "column", result_column, 1);
+    rb_define_method(cCassResult, "packed_column", result_packed_column, -1);
+    rb_define_method(cCassResult, "free", result_free_now, 0);
+    rb_define_method(cCassResult, "freed?", result_freed, 0);
     
     // Include Enumerable to get all the Enumerable methods
     rb_include_module(cCassResult, rb_mEnumerable);
+
+    id_view_owner = rb_intern("__result__");    // No "@", so hidden from Ruby
+    id_aset = rb_intern("[]=");
+    id_keys = rb_intern("keys");
+    cWeakMap = rb_const_get(rb_const_get(rb_cObject, rb_intern("ObjectSpace")), rb_intern("WeakMap"));
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "cassandra_c.h"
+
+VALUE cCassRow;
+
+// Mark function for Row
+static void row_mark(void* ptr) {
+    RowWrapper* wrapper = (RowWrapper*)ptr;
+    rb_gc_mark(wrapper->result);
+    for (size_t i = 0; i < wrapper->column_count; i++) {
+        if (wrapper->values[i] != Qundef) {
+            rb_gc_mark(wrapper->values[i]);
+        }
+    }
+}
+
+// Free function for Row
+static void row_free(void* ptr) {
+    RowWrapper* wrapper = (RowWrapper*)ptr;
+    xfree(wrapper->values);
+    xfree(wrapper);
+}
+
+static size_t row_memsize(const void* ptr) {
+    const RowWrapper* wrapper = (const RowWrapper*)ptr;
+    return sizeof(RowWrapper) + wrapper->column_count * sizeof(VALUE);
+}
+
+// Data type for Row
+const rb_data_type_t row_type = {
+    .wrap_struct_name = "CassRow",
+    .function = {
+        .dmark = row_mark,
+        .dfree = row_free,
+        .dsize = row_memsize,
+    },
+    .data = NULL,
+    .flags = RUBY_TYPED_FREE_IMMEDIATELY
+};
+
+// Rows only come from Result#each_row
+VALUE row_new(VALUE result, size_t index, size_t column_count) {
+    RowWrapper* wrapper;
+    VALUE rb_row = TypedData_Make_Struct(cCassRow, RowWrapper, &row_type, wrapper);
+    wrapper->result = result;
+    wrapper->index = index;
+    wrapper->column_count = column_count;
+    wrapper->values = ALLOC_N(VALUE, column_count);
+    for (size_t i = 0; i < column_count; i++) {
+        wrapper->values[i] = Qundef;
+    }
+    return rb_row;
+}
+
+// Decode column `i` on first access
+static VALUE row_value_at(RowWrapper* wrapper, size_t i) {
+    if (wrapper->values[i] == Qundef) {
+        const CassRow* row = result_row_at(wrapper->result, wrapper->index);
+        ValueDecoderFn decoder = result_decoders(wrapper->result)[i];
+        wrapper->values[i] = result_decode_cell(wrapper->result, decoder, cass_row_get_column(row, i));
+    }
+    return wrapper->values[i];
+}
+
+// Value of a column by index (negative counts from the end) or name. Returns
+// nil for a missing column.
+static VALUE row_aref(VALUE self, VALUE key) {
+    RowWrapper* wrapper;
+    TypedData_Get_Struct(self, RowWrapper, &row_type, wrapper);
+
+    long index;
+    if (RB_INTEGER_TYPE_P(key)) {
+        index = NUM2LONG(key);
+        if (index < 0) {
+            index += (long)wrapper->column_count;
+        }
+    } else {
+        index = result_column_index_by_name(wrapper->result, key);
+    }
+
+    if (index < 0 || (size_t)index >= wrapper->column_count) {
+        return Qnil;
+    }
+    return row_value_at(wrapper, (size_t)index);
+}
+
+// Number of columns
+static VALUE row_size(VALUE self) {
+    RowWrapper* wrapper;
+    TypedData_Get_Struct(self, RowWrapper, &row_type, wrapper);
+    return SIZET2NUM(wrapper->column_count);
+}
+
+// All column values, decoding any not read yet
+static VALUE row_to_a(VALUE self) {
+    RowWrapper* wrapper;
+    TypedData_Get_Struct(self, RowWrapper, &row_type, wrapper);
+
+    VALUE values = rb_ary_new_capa((long)wrapper->column_count);
+    for (size_t i = 0; i < wrapper->column_count; i++) {
+        rb_ary_push(values, row_value_at(wrapper, i));
+    }
+    return values;
+}
+
+// Initialize the Row class
+void Init_cassandra_c_row(VALUE module) {
+    cCassRow = rb_define_class_under(module, "Row", rb_cObject);
+    rb_undef_alloc_func(cCassRow);
+    rb_define_method(cCassRow, "[]", row_aref, 1);
+    rb_define_method(cCassRow, "size", row_size, 0);
+    rb_define_method(cCassRow, "length", row_size, 0);
+    rb_define_method(cCassRow, "to_a", row_to_a, 0);
+}
@@ -1,4 +1,172 @@
 #include "cassandra_c.h"
+#include "ruby/thread.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+// ============================================================================
+// Admission Control
+// ============================================================================
+
+// Counts the requests a session has in flight and optionally bounds them.
+// Slots are released from driver callbacks, so the limiter is reference
+// counted (one reference for the Session plus one per in-flight request).
+struct SessionLimiter {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    long in_flight;
+    long max_in_flight;     // 0 means unlimited
+    long refs;
+};
+
+static SessionLimiter* session_limiter_new(void) {
+    SessionLimiter* limiter = malloc(sizeof(SessionLimiter));
+    if (limiter == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&limiter->lock, NULL);
+    pthread_cond_init(&limiter->cond, NULL);
+    limiter->in_flight = 0;
+    limiter->max_in_flight = 0;
+    limiter->refs = 1;
+    return limiter;
+}
+
+static void session_limiter_unref(SessionLimiter* limiter, int slot) {
+    pthread_mutex_lock(&limiter->lock);
+    if (slot) {
+        limiter->in_flight--;
+        pthread_cond_signal(&limiter->cond);
+    }
+    long refs = --limiter->refs;
+    pthread_mutex_unlock(&limiter->lock);
+    if (refs == 0) {
+        pthread_cond_destroy(&limiter->cond);
+        pthread_mutex_destroy(&limiter->lock);
+        free(limiter);
+    }
+}
+
+// Release one in-flight slot. A FutureListenerFn, so it runs on driver IO
+// threads: must not touch any Ruby objects.
+void session_limiter_release(void* data) {
+    session_limiter_unref((SessionLimiter*)data, 1);
+}
+
+typedef struct {
+    SessionLimiter* limiter;
+    cass_int64_t deadline_us;   // Monotonic, or FUTURE_WAIT_FOREVER
+    int interrupted;
+    int acquired;
+} SessionAdmitArgs;
+
+// Take a slot if one is free; with the lock held
+static int session_limiter_try_locked(SessionLimiter* limiter) {
+    if (limiter->max_in_flight > 0 && limiter->in_flight >= limiter->max_in_flight) {
+        return 0;
+    }
+    limiter->in_flight++;
+    limiter->refs++;
+    return 1;
+}
+
+static void* session_admit_nogvl(void* ptr) {
+    SessionAdmitArgs* args = (SessionAdmitArgs*)ptr;
+    SessionLimiter* limiter = args->limiter;
+
+    pthread_mutex_lock(&limiter->lock);
+    while (!(args->acquired = session_limiter_try_locked(limiter)) && !args->interrupted) {
+        if (args->deadline_us == FUTURE_WAIT_FOREVER) {
+            pthread_cond_wait(&limiter->cond, &limiter->lock);
+            continue;
+        }
+
+        // The condition variable uses the realtime clock
+        cass_int64_t remaining = args->deadline_us - monotonic_us();
+        if (remaining <= 0) {
+            break;
+        }
+        struct timespec until;
+        clock_gettime(CLOCK_REALTIME, &until);
+        cass_int64_t nsec = until.tv_nsec + (remaining % 1000000) * 1000;
+        until.tv_sec += remaining / 1000000 + nsec / 1000000000;
+        until.tv_nsec = nsec % 1000000000;
+        pthread_cond_timedwait(&limiter->cond, &limiter->lock, &until);
+    }
+    pthread_mutex_unlock(&limiter->lock);
+    return NULL;
+}
+
+static void session_admit_ubf(void* ptr) {
+    SessionAdmitArgs* args = (SessionAdmitArgs*)ptr;
+    pthread_mutex_lock(&args->limiter->lock);
+    args->interrupted = 1;
+    pthread_cond_broadcast(&args->limiter->cond);
+    pthread_mutex_unlock(&args->limiter->lock);
+}
+
+// Take an in-flight slot before starting a request. When the session is at
+// its limit this blocks without the GVL until a request completes, or returns
+// 0 straight away if `blocking` is not set or once `deadline_us` passes.
+static int session_admit(SessionWrapper* wrapper, int blocking, cass_int64_t deadline_us) {
+    SessionLimiter* limiter = wrapper->limiter;
+
+    pthread_mutex_lock(&limiter->lock);
+    int acquired = session_limiter_try_locked(limiter);
+    pthread_mutex_unlock(&limiter->lock);
+    if (acquired || !blocking) {
+        return acquired;
+    }
+
+    SessionAdmitArgs args;
+    args.limiter = limiter;
+    args.deadline_us = deadline_us;
+    args.acquired = 0;
+    for (;;) {
+        args.interrupted = 0;
+        rb_thread_call_without_gvl(session_admit_nogvl, &args, session_admit_ubf, &args);
+        if (args.acquired) {
+            return 1;
+        }
+        if (deadline_us != FUTURE_WAIT_FOREVER && monotonic_us() >= deadline_us) {
+            return 0;
+        }
+        rb_thread_check_ints();
+    }
+}
+
+// The `deadline:` option (seconds from now) as a monotonic deadline in
+// microseconds, or FUTURE_WAIT_FOREVER without one. *timeout_ms is set to the
+// matching driver request timeout.
+static cass_int64_t session_deadline(VALUE options, cass_uint64_t* timeout_ms) {
+    *timeout_ms = 0;
+    if (NIL_P(options)) {
+        return FUTURE_WAIT_FOREVER;
+    }
+    VALUE deadline = rb_hash_aref(options, ID2SYM(rb_intern("deadline")));
+    if (NIL_P(deadline)) {
+        return FUTURE_WAIT_FOREVER;
+    }
+
+    double seconds = NUM2DBL(deadline);
+    if (!(seconds > 0)) {
+        rb_raise(rb_eArgError, "deadline must be positive");
+    }
+    *timeout_ms = (cass_uint64_t)ceil(seconds * 1000.0);
+    return monotonic_us() + (cass_int64_t)(seconds * 1000000.0);
+}
+
+// Admit a request that has a deadline, raising if it passes first
+static void session_admit_by(SessionWrapper* wrapper, cass_int64_t deadline_us, const char* failure) {
+    if (!session_admit(wrapper, 1, deadline_us)) {
+        rb_raise(rb_eCassandraError, "%s: request deadline exceeded", failure);
+    }
+}
+
+// ============================================================================
+// Session Class
+// ============================================================================
 
 // Memory management for Session
 static void rb_session_free(void* ptr) {
@@ -6,10 +174,14 @@ static void rb_session_free(void* ptr) {
     if (wrapper->session != NULL) {
         cass_session_free(wrapper->session);
     }
+    if (wrapper->limiter != NULL) {
+        session_limiter_unref(wrapper->limiter, 0);
+    }
     xfree(wrapper);
 }
 
-// Define the Ruby data type for Session
+// Define the Ruby data type for Session. The driver session is thread-safe, so a
+// frozen Session can be shared between Ractors.
 const rb_data_type_t session_type = {
     .wrap_struct_name = "CassSession",
     .function = {
@@ -18,17 +190,144 @@ const rb_data_type_t session_type = {
         .dsize = NULL,
     },
     .data = NULL,
-    .flags = RUBY_TYPED_FREE_IMMEDIATELY
+    .flags = RUBY_TYPED_FREE_IMMEDIATELY | RUBY_TYPED_FROZEN_SHAREABLE
 };
 
 // Allocation function for Session
 static VALUE rb_session_allocate(VALUE klass) {
     SessionWrapper* wrapper = ALLOC(SessionWrapper);
+    wrapper->session = NULL;
+    wrapper->limiter = NULL;
+    VALUE self = TypedData_Wrap_Struct(klass, &session_type, wrapper);
+
     wrapper->session = cass_session_new();
     if (!wrapper->session) {
         rb_raise(rb_eRuntimeError, "Failed to create CassSession");
     }
-    return TypedData_Wrap_Struct(klass, &session_type, wrapper);
+    wrapper->limiter = session_limiter_new();
+    if (!wrapper->limiter) {
+        rb_raise(rb_eNoMemError, "Failed to allocate session limiter");
+    }
+    return self;
+}
+
+// Hand `future` to the CompletionQueue given as the `queue:` option, if any.
+// Returns 1 when the queue took ownership of the future.
+static int session_submit_to_queue(SessionWrapper* wrapper, VALUE options, CassFuture* future, FutureKind kind) {
+    if (NIL_P(options)) {
+        return 0;
+    }
+    VALUE queue = rb_hash_aref(options, ID2SYM(rb_intern("queue")));
+    if (NIL_P(queue)) {
+        return 0;
+    }
+    if (!rb_obj_is_kind_of(queue, cCassCompletionQueue)) {
+        cass_future_free(future);
+        session_limiter_release(wrapper->limiter);
+        rb_raise(rb_eTypeError, "Expected CompletionQueue for queue option");
+    }
+
+    VALUE tag = rb_hash_aref(options, ID2SYM(rb_intern("tag")));
+    completion_queue_submit(queue, future, kind, tag, session_limiter_release, wrapper->limiter);
+    return 1;
+}
+
+typedef struct {
+    CassFuture* future;
+    FutureCompletion* completion;   // Registered by a Fiber-scheduler wait, or NULL
+    cass_int64_t deadline_us;
+    cass_bool_t completed;
+} SessionWaitArgs;
+
+static VALUE session_wait_body(VALUE ptr) {
+    SessionWaitArgs* args = (SessionWaitArgs*)ptr;
+    cass_int64_t timeout_us = FUTURE_WAIT_FOREVER;
+    if (args->deadline_us != FUTURE_WAIT_FOREVER) {
+        timeout_us = args->deadline_us - monotonic_us();
+        if (timeout_us < 0) {
+            timeout_us = 0;
+        }
+    }
+    args->completed = future_wait_with_completion(args->future, &args->completion, timeout_us, 0);
+    return Qnil;
+}
+
+// Give up on a request that is still running: its in-flight slot is released,
+// and the future freed, once the driver completes it. The driver accepts a
+// single callback per future, so the completion a Fiber-scheduler wait
+// registered is reused.
+static void session_abandon(SessionWrapper* wrapper, CassFuture* future, FutureCompletion* completion) {
+    if (completion == NULL) {
+        completion = future_completion_new(future);
+    }
+    future_completion_listen(completion, session_limiter_release, wrapper->limiter);
+    future_completion_release(completion);
+    cass_future_free(future);
+}
+
+// Deliver an admitted request's future the way the options ask for: to a
+// CompletionQueue (queue:), as a Future (async: true), or by waiting for it
+// and returning its Result or Prepared. The in-flight slot is released when
+// the request completes. A synchronous wait gives up once `deadline_us` passes.
+static VALUE session_finish(SessionWrapper* wrapper, VALUE options, CassFuture* future,
+                            FutureKind kind, const char* failure, cass_int64_t deadline_us) {
+    // Deliver the completion to a CompletionQueue instead of returning it
+    if (session_submit_to_queue(wrapper, options, future, kind)) {
+        return Qnil;
+    }
+
+    // Check if async option is provided and true
+    VALUE async = Qfalse;
+    if (!NIL_P(options)) {
+        async = rb_hash_aref(options, ID2SYM(rb_intern("async")));
+    }
+
+    if (RTEST(async)) {
+        // Return a Future object for async operation
+        VALUE rb_future = future_new(future, kind);
+        future_set_deadline(rb_future, deadline_us);
+        future_listen(rb_future, session_limiter_release, wrapper->limiter);
+        return rb_future;
+    }
+
+    // Wait for the request to complete. A request abandoned by an interrupt or
+    // at the deadline keeps its slot until the driver completes it.
+    SessionWaitArgs args;
+    args.future = future;
+    args.completion = NULL;
+    args.deadline_us = deadline_us;
+    args.completed = cass_false;
+    int state = 0;
+    rb_protect(session_wait_body, (VALUE)&args, &state);
+    if (state) {
+        session_abandon(wrapper, future, args.completion);
+        rb_jump_tag(state);
+    }
+    if (!args.completed) {
+        session_abandon(wrapper, future, args.completion);
+        rb_raise(rb_eCassandraError, "%s: request deadline exceeded", failure);
+    }
+    if (args.completion != NULL) {
+        future_completion_release(args.completion);
+    }
+    session_limiter_release(wrapper->limiter);
+
+    // Check for errors
+    CassError error = cass_future_error_code(future);
+    if (error != CASS_OK) {
+        raise_future_error(future, failure);
+    }
+
+    VALUE value = Qnil;
+    if (kind == FUTURE_KIND_PREPARED) {
+        value = prepared_new(cass_future_get_prepared(future));
+    } else {
+        // Cast away const since we transfer ownership to Ruby's GC via result_new
+        value = result_new((CassResult*)cass_future_get_result(future));
+    }
+
+    cass_future_free(future);
+    return value;
 }
 
 // Initialize method for Session (no arguments)
@@ -60,10 +359,10 @@ static VALUE rb_session_connect(int argc, VALUE* argv, VALUE self) {
 
     if (RTEST(async)) {
         // Return a Future object for async operation
-        return future_new(connect_future);
+        return future_new(connect_future, FUTURE_KIND_EMPTY);
     } else {
         // Wait for the connection to complete
-        cass_future_wait(connect_future);
+        future_wait_without_gvl(connect_future, FUTURE_WAIT_FOREVER, 1);
 
         // Check for errors during connection
         CassError error = cass_future_error_code(connect_future);
@@ -83,7 +382,7 @@ static VALUE rb_session_close(VALUE self) {
 
     if (wrapper->session != NULL) {
         CassFuture* close_future = cass_session_close(wrapper->session);
-        cass_future_wait(close_future);
+        future_wait_without_gvl(close_future, FUTURE_WAIT_FOREVER, 1);
 
         CassError error = cass_future_error_code(close_future);
         if (error != CASS_OK) {
@@ -106,36 +405,10 @@ static VALUE rb_session_prepare(int argc, VALUE* argv, VALUE self) {
 
     Check_Type(query, T_STRING);
 
+    session_admit(wrapper, 1, FUTURE_WAIT_FOREVER);
     CassFuture* prepare_future = cass_session_prepare(wrapper->session, StringValueCStr(query));
-
-    // Check if async option is provided and true
-    VALUE async = Qfalse;
-    if (!NIL_P(options)) {
-        async = rb_hash_aref(options, ID2SYM(rb_intern("async")));
-    }
-
-    if (RTEST(async)) {
-        // Return a Future object for async operation
-        return future_new(prepare_future);
-    } else {
-        // Wait for the preparation to complete
-        cass_future_wait(prepare_future);
-
-        // Check for errors during preparation
-        CassError error = cass_future_error_code(prepare_future);
-        if (error != CASS_OK) {
-            raise_future_error(prepare_future, "Failed to prepare statement");
-        }
-
-        const CassPrepared* prepared = cass_future_get_prepared(prepare_future);
-
-        VALUE rb_prepared = prepared_new(prepared);
-
-        cass_future_free(prepare_future);
-
-        return rb_prepared;
-      // return Qnil;
-    }
+    return session_finish(wrapper, options, prepare_future, FUTURE_KIND_PREPARED, "Failed to prepare statement",
+                          FUTURE_WAIT_FOREVER);
 }
 
 // Get the client_id
@@ -151,76 +424,135 @@ static VALUE rb_session_get_client_id(VALUE self) {
     return rb_str_new_cstr(uuid_str);
 }
 
-// Execute a statement
-static VALUE rb_session_execute(int argc, VALUE* argv, VALUE self) {
+// Let a prepared statement's Result (or the Result its Future resolves to)
+// reuse the column metadata cached on the Prepared
+static void session_share_metadata(VALUE value, VALUE prepared) {
+    if (rb_obj_is_kind_of(value, cCassResult)) {
+        result_use_prepared_metadata(value, prepared);
+    } else if (rb_obj_is_kind_of(value, cCassFuture)) {
+        future_set_prepared(value, prepared);
+    }
+}
+
+// Let the Result (or the Result its Future resolves to) fetch its following
+// pages through this session and statement
+static void session_share_source(VALUE value, VALUE session, VALUE statement) {
+    if (rb_obj_is_kind_of(value, cCassResult)) {
+        result_set_source(value, session, statement);
+    } else if (rb_obj_is_kind_of(value, cCassFuture)) {
+        future_set_source(value, session, statement);
+    }
+}
+
+// Execute a statement. With `admit_blocking` unset a session at its in-flight
+// limit returns :busy instead of waiting for a slot.
+static VALUE session_execute(int argc, VALUE* argv, VALUE self, int admit_blocking) {
     VALUE statement, options;
     rb_scan_args(argc, argv, "1:", &statement, &options);
 
     SessionWrapper* wrapper;
     TypedData_Get_Struct(self, SessionWrapper, &session_type, wrapper);
 
-    // Declare future variable
-    CassFuture* future;
-    
     // Extract the CassStatement from the Ruby Statement object
-    StatementWrapper* statement_wrapper;
+    StatementWrapper* statement_wrapper = NULL;
 
     if (rb_obj_is_kind_of(statement, cCassStatement)) {
-        TypedData_Get_Struct(statement, StatementWrapper, &statement_type, statement_wrapper);
+        statement_wrapper = statement_get(statement);
     } else if (TYPE(statement) == T_STRING) {
-        // If a string is provided, create a temporary Statement object
-        CassStatement* cass_statement = cass_statement_new(StringValueCStr(statement), 0);
-        if (!cass_statement) {
-            rb_raise(rb_eCassandraError, "Failed to create statement from query string");
-        }
-        
-        // Execute the query and capture the future
-        future = cass_session_execute(wrapper->session, cass_statement);
-        
-        // Free the temporary statement since it's no longer needed
-        cass_statement_free(cass_statement);
-        
-        // Process the future (code continues below)
-        statement_wrapper = NULL; // Not used in this path
+        // A temporary statement is created once a slot has been admitted
+        StringValueCStr(statement);
     } else {
         rb_raise(rb_eTypeError, "Expected Statement object or query string");
         return Qnil;  // Not reached
     }
 
+    cass_uint64_t timeout_ms;
+    cass_int64_t deadline_us = session_deadline(options, &timeout_ms);
+    if (!session_admit(wrapper, admit_blocking, deadline_us)) {
+        if (!admit_blocking) {
+            return ID2SYM(rb_intern("busy"));
+        }
+        rb_raise(rb_eCassandraError, "Failed to execute statement: request deadline exceeded");
+    }
+
     // Execute the query and capture the future
+    CassFuture* future;
     if (statement_wrapper) {
+        // Another thread may have freed the statement while this one waited
+        // for a slot
+        if (statement_wrapper->statement == NULL) {
+            session_limiter_release(wrapper->limiter);
+            rb_raise(rb_eCassandraError, "Statement has been freed");
+        }
+        // The deadline becomes the statement's request timeout
+        statement_apply_deadline(statement_wrapper, deadline_us, timeout_ms);
         future = cass_session_execute(wrapper->session, statement_wrapper->statement);
+    } else {
+        // If a string is provided, create a temporary Statement object
+        CassStatement* cass_statement = cass_statement_new(RSTRING_PTR(statement), 0);
+        if (!cass_statement) {
+            session_limiter_release(wrapper->limiter);
+            rb_raise(rb_eCassandraError, "Failed to create statement from query string");
+        }
+
+        if (deadline_us != FUTURE_WAIT_FOREVER) {
+            cass_statement_set_request_timeout(cass_statement, timeout_ms);
+        }
+        future = cass_session_execute(wrapper->session, cass_statement);
+
+        // Free the temporary statement since it's no longer needed
+        cass_statement_free(cass_statement);
     }
-    // future already set if string path was taken
-    
-    // Check if async option is provided and true
-    VALUE async = Qfalse;
-    if (!NIL_P(options)) {
-        async = rb_hash_aref(options, ID2SYM(rb_intern("async")));
+
+    VALUE value = session_finish(wrapper, options, future, FUTURE_KIND_RESULT, "Failed to execute statement",
+                                 deadline_us);
+    if (statement_wrapper != NULL) {
+        if (!NIL_P(statement_wrapper->prepared)) {
+            session_share_metadata(value, statement_wrapper->prepared);
+        }
+        session_share_source(value, self, statement);
     }
+    return value;
+}
 
-    if (RTEST(async)) {
-        // Return a Future object for async operation
-        return future_new(future);
-    } else {
-        // Wait for the execution to complete
-        cass_future_wait(future);
+static VALUE session_yield_result(VALUE result) {
+    return rb_yield(result);
+}
 
-        // Check for errors
-        CassError error = cass_future_error_code(future);
-        if (error != CASS_OK) {
-            raise_future_error(future, "Failed to execute statement");
-        }
+// Execute a statement, waiting for an in-flight slot if the session is at its
+// limit. With a block the Result is yielded and freed as soon as the block
+// returns (see Result#free), and the block's value is returned.
+static VALUE rb_session_execute(int argc, VALUE* argv, VALUE self) {
+    if (!rb_block_given_p()) {
+        return session_execute(argc, argv, self, 1);
+    }
 
-        // Get the result
-        const CassResult* result = cass_future_get_result(future);
-        // Cast away const since we transfer ownership to Ruby's GC via result_new
-        VALUE rb_result = result_new((CassResult*)result);
-        
-        cass_future_free(future);
-        
-        return rb_result;
+    VALUE statement, options;
+    rb_scan_args(argc, argv, "1:", &statement, &options);
+    if (!NIL_P(options) && (RTEST(rb_hash_aref(options, ID2SYM(rb_intern("async")))) ||
+                            !NIL_P(rb_hash_aref(options, ID2SYM(rb_intern("queue")))))) {
+        rb_raise(rb_eArgError, "execute with a block cannot be async or use a queue");
     }
+
+    VALUE result = session_execute(argc, argv, self, 1);
+    return rb_ensure(session_yield_result, result, result_free_now, result);
+}
+
+// Execute a statement, or return :busy if the session is at its in-flight limit
+static VALUE rb_session_try_execute(int argc, VALUE* argv, VALUE self) {
+    return session_execute(argc, argv, self, 0);
+}
+
+// Start a chained future's execution (Future#then_execute). Waits for an
+// in-flight slot like execute; the slot is released when the request completes.
+void session_execute_into(VALUE session, StatementWrapper* statement, VALUE future) {
+    SessionWrapper* wrapper;
+    TypedData_Get_Struct(session, SessionWrapper, &session_type, wrapper);
+
+    session_admit(wrapper, 1, FUTURE_WAIT_FOREVER);
+    statement_apply_deadline(statement, FUTURE_WAIT_FOREVER, 0);
+    future_attach(future, cass_session_execute(wrapper->session, statement->statement), FUTURE_KIND_RESULT);
+    future_listen(future, session_limiter_release, wrapper->limiter);
 }
 
 // Execute a batch statement
@@ -238,37 +570,360 @@ static VALUE rb_session_execute_batch(int argc, VALUE* argv, VALUE self) {
         rb_raise(rb_eCassandraError, "Batch is NULL");
     }
 
+    cass_uint64_t timeout_ms;
+    cass_int64_t deadline_us = session_deadline(options, &timeout_ms);
+    session_admit_by(wrapper, deadline_us, "Failed to execute batch");
+    batch_apply_deadline(batch_wrapper, deadline_us, timeout_ms);
+
     // Execute the batch and capture the future
     CassFuture* future = cass_session_execute_batch(wrapper->session, batch_wrapper->batch);
+    return session_finish(wrapper, options, future, FUTURE_KIND_RESULT, "Failed to execute batch", deadline_us);
+}
 
-    // Check if async option is provided and true
-    VALUE async = Qfalse;
+// Maximum number of requests in flight (nil when unlimited)
+static VALUE rb_session_get_max_in_flight(VALUE self) {
+    SessionWrapper* wrapper;
+    TypedData_Get_Struct(self, SessionWrapper, &session_type, wrapper);
+
+    pthread_mutex_lock(&wrapper->limiter->lock);
+    long max = wrapper->limiter->max_in_flight;
+    pthread_mutex_unlock(&wrapper->limiter->lock);
+    return max > 0 ? LONG2NUM(max) : Qnil;
+}
+
+// Bound the number of requests in flight; nil or 0 removes the limit
+static VALUE rb_session_set_max_in_flight(VALUE self, VALUE max) {
+    rb_check_frozen(self);
+    SessionWrapper* wrapper;
+    TypedData_Get_Struct(self, SessionWrapper, &session_type, wrapper);
+
+    long value = NIL_P(max) ? 0 : NUM2LONG(max);
+    if (value < 0) {
+        rb_raise(rb_eArgError, "max_in_flight must not be negative");
+    }
+
+    pthread_mutex_lock(&wrapper->limiter->lock);
+    wrapper->limiter->max_in_flight = value;
+    pthread_cond_broadcast(&wrapper->limiter->cond);
+    pthread_mutex_unlock(&wrapper->limiter->lock);
+    return max;
+}
+
+// Number of requests started through this session that have not completed
+static VALUE rb_session_in_flight(VALUE self) {
+    SessionWrapper* wrapper;
+    TypedData_Get_Struct(self, SessionWrapper, &session_type, wrapper);
+
+    pthread_mutex_lock(&wrapper->limiter->lock);
+    long in_flight = wrapper->limiter->in_flight;
+    pthread_mutex_unlock(&wrapper->limiter->lock);
+    return LONG2NUM(in_flight);
+}
+
+// ============================================================================
+// Concurrent Execution
+// ============================================================================
+
+#define EXECUTE_CONCURRENT_DEFAULT_WINDOW 512
+
+typedef struct {
+    SessionWrapper* session;
+    const CassPrepared* prepared;
+    VALUE rb_prepared;
+    VALUE rows;
+    VALUE results;
+    long concurrency;
+    CompletionQueueState* state;
+    MpscNode* drained;      // Collected completions not yet stored in results
+} ConcurrentExecution;
+
+typedef struct {
+    CassStatement* statement;
+    VALUE params;
+    long failed_index;
+    CassError error;
+} ConcurrentBind;
+
+static VALUE concurrent_bind_row(VALUE ptr) {
+    ConcurrentBind* bind = (ConcurrentBind*)ptr;
+    VALUE params = rb_check_array_type(bind->params);
+    if (NIL_P(params)) {
+        rb_raise(rb_eArgError, "Parameters must be an array");
+    }
+    bind->error = bind_positional_params(bind->statement, params, &bind->failed_index);
+    return Qnil;
+}
+
+// Bind and start the request for `index`. A row that fails to bind gets its
+// error stored in results right away and nothing is put in flight.
+static int concurrent_start(ConcurrentExecution* exec, long index) {
+    // Interrupts while waiting for admission are handled by concurrent_cleanup
+    session_admit(exec->session, 1, FUTURE_WAIT_FOREVER);
+
+    CassStatement* statement = cass_prepared_bind(exec->prepared);
+    if (statement == NULL) {
+        session_limiter_release(exec->session->limiter);
+        rb_raise(rb_eCassandraError, "Failed to bind prepared statement");
+    }
+
+    ConcurrentBind bind;
+    bind.statement = statement;
+    bind.params = RARRAY_AREF(exec->rows, index);
+    bind.failed_index = 0;
+    bind.error = CASS_OK;
+
+    int state = 0;
+    rb_protect(concurrent_bind_row, (VALUE)&bind, &state);
+    if (state || bind.error != CASS_OK) {
+        cass_statement_free(statement);
+        session_limiter_release(exec->session->limiter);
+    }
+    if (state) {
+        VALUE error = rb_errinfo();
+        if (!RTEST(rb_obj_is_kind_of(error, rb_eStandardError))) {
+            rb_jump_tag(state);
+        }
+        rb_set_errinfo(Qnil);
+        rb_ary_store(exec->results, index, error);
+        return 0;
+    }
+    if (bind.error != CASS_OK) {
+        VALUE message = rb_sprintf("Failed to bind parameter at index %ld: %s",
+                                   bind.failed_index, cass_error_desc(bind.error));
+        rb_ary_store(exec->results, index, rb_exc_new_str(rb_eCassandraError, message));
+        return 0;
+    }
+
+    CassFuture* future = cass_session_execute(exec->session->session, statement);
+    cass_statement_free(statement);
+    completion_queue_state_submit(exec->state, future, FUTURE_KIND_RESULT, index,
+                                  session_limiter_release, exec->session->limiter);
+    return 1;
+}
+
+static VALUE concurrent_run(VALUE ptr) {
+    ConcurrentExecution* exec = (ConcurrentExecution*)ptr;
+    long count = RARRAY_LEN(exec->rows);
+    long next = 0;
+    long in_flight = 0;
+
+    for (;;) {
+        // Refill the window
+        while (next < count && in_flight < exec->concurrency) {
+            in_flight += concurrent_start(exec, next++);
+        }
+        if (in_flight == 0) {
+            break;
+        }
+
+        exec->drained = completion_queue_state_wait(exec->state, -1);
+        while (exec->drained != NULL) {
+            CompletionNode* node = (CompletionNode*)exec->drained;
+            exec->drained = node->node.next;
+            in_flight--;
+
+            VALUE value = future_resolve_value(node->future, node->kind);
+            long index = node->id;
+            completion_node_free(node);
+            session_share_metadata(value, exec->rb_prepared);
+            rb_ary_store(exec->results, index, value);
+        }
+    }
+
+    return exec->results;
+}
+
+// Requests still in flight after an interrupt complete into the released state
+static VALUE concurrent_cleanup(VALUE ptr) {
+    ConcurrentExecution* exec = (ConcurrentExecution*)ptr;
+    while (exec->drained != NULL) {
+        CompletionNode* node = (CompletionNode*)exec->drained;
+        exec->drained = node->node.next;
+        completion_node_free(node);
+    }
+    completion_queue_state_release(exec->state);
+    return Qnil;
+}
+
+// Bind every element of `rows` (an array of parameter arrays) to `prepared`
+// and execute them with at most `concurrency:` requests in flight. Returns an
+// array aligned with `rows` holding a Result or a CassandraC::Error per row.
+static VALUE rb_session_execute_concurrent(int argc, VALUE* argv, VALUE self) {
+    VALUE prepared, rows, options;
+    rb_scan_args(argc, argv, "2:", &prepared, &rows, &options);
+
+    SessionWrapper* wrapper;
+    TypedData_Get_Struct(self, SessionWrapper, &session_type, wrapper);
+
+    PreparedWrapper* prepared_wrapper;
+    TypedData_Get_Struct(prepared, PreparedWrapper, &prepared_type, prepared_wrapper);
+    if (prepared_wrapper->prepared == NULL) {
+        rb_raise(rb_eCassandraError, "Prepared statement is NULL");
+    }
+
+    long concurrency = EXECUTE_CONCURRENT_DEFAULT_WINDOW;
     if (!NIL_P(options)) {
-        async = rb_hash_aref(options, ID2SYM(rb_intern("async")));
+        VALUE rb_concurrency = rb_hash_aref(options, ID2SYM(rb_intern("concurrency")));
+        if (!NIL_P(rb_concurrency)) {
+            concurrency = NUM2LONG(rb_concurrency);
+        }
+    }
+    if (concurrency <= 0) {
+        rb_raise(rb_eArgError, "concurrency must be positive");
     }
 
-    if (RTEST(async)) {
-        // Return a Future object for async operation
-        return future_new(future);
-    } else {
-        // Wait for the execution to complete
-        cass_future_wait(future);
+    ConcurrentExecution exec;
+    exec.session = wrapper;
+    exec.prepared = prepared_wrapper->prepared;
+    exec.rb_prepared = prepared;
+    // Snapshot the rows so they cannot change underneath the pipeline
+    exec.rows = rb_ary_dup(rb_convert_type(rows, T_ARRAY, "Array", "to_ary"));
+    exec.results = rb_ary_new_capa(RARRAY_LEN(exec.rows));
+    exec.concurrency = concurrency;
+    exec.drained = NULL;
+    exec.state = completion_queue_state_new();
+
+    VALUE results = rb_ensure(concurrent_run, (VALUE)&exec, concurrent_cleanup, (VALUE)&exec);
+    RB_GC_GUARD(exec.rows);
+    RB_GC_GUARD(prepared);
+    return results;
+}
 
-        // Check for errors
-        CassError error = cass_future_error_code(future);
-        if (error != CASS_OK) {
-            raise_future_error(future, "Failed to execute batch");
+// ============================================================================
+// Paging
+// ============================================================================
+
+static ID id_execute;
+static ID id_get_result;
+static ID id_each;
+static ID id_async;
+static ID id_page_size;
+static ID id_wait;
+
+typedef struct {
+    VALUE session;
+    VALUE statement;
+    VALUE page;             // First page, or nil to fetch it
+    int rows;               // Yield each page's rows rather than the pages
+    VALUE next;             // Future of the prefetched next page, or nil
+    int page_size;          // Page size to restore afterwards, or 0 to leave it
+} PageWalk;
+
+// Start fetching the statement's next page through Session#execute
+static VALUE session_request_page(VALUE session, VALUE statement) {
+    VALUE options = rb_hash_new();
+    rb_hash_aset(options, ID2SYM(id_async), Qtrue);
+    VALUE args[2] = {statement, options};
+    return rb_funcallv_kw(session, id_execute, 2, args, RB_PASS_KEYWORDS);
+}
+
+static VALUE session_page_walk(VALUE ptr) {
+    PageWalk* walk = (PageWalk*)ptr;
+    VALUE page = walk->page;
+    if (NIL_P(page)) {
+        page = rb_funcall(session_request_page(walk->session, walk->statement), id_get_result, 0);
+    }
+    for (;;) {
+        // Request page N+1 before handing page N to the block, so the round
+        // trip overlaps with processing. The block may have freed the
+        // statement, so it is looked up again for every page.
+        ResultWrapper* result_wrapper = result_get(page);
+        VALUE next = Qnil;
+        if (cass_result_has_more_pages(result_wrapper->result)) {
+            StatementWrapper* statement_wrapper = statement_get(walk->statement);
+            CassError error = cass_statement_set_paging_state(statement_wrapper->statement, result_wrapper->result);
+            if (error != CASS_OK) {
+                rb_raise(rb_eCassandraError, "Failed to set paging state: %s", cass_error_desc(error));
+            }
+            next = session_request_page(walk->session, walk->statement);
         }
+        walk->next = next;
 
-        // Get the result
-        const CassResult* result = cass_future_get_result(future);
-        // Cast away const since we transfer ownership to Ruby's GC via result_new
-        VALUE rb_result = result_new((CassResult*)result);
-        
-        cass_future_free(future);
-        
-        return rb_result;
+        if (walk->rows) {
+            rb_funcall_passing_block(page, id_each, 0, NULL);
+        } else {
+            rb_yield(page);
+        }
+
+        if (NIL_P(next)) {
+            return Qnil;
+        }
+        page = rb_funcall(next, id_get_result, 0);
+        walk->next = Qnil;
+    }
+}
+
+static VALUE session_page_wait(VALUE future) {
+    return rb_funcall(future, id_wait, 0);
+}
+
+// Leave the statement starting from the first page again, with the page size
+// it had. A walk left early (break or an exception) may still have the next
+// page in flight; the driver reads the statement while sending it, so that
+// request is waited for before the statement changes. Its outcome is dropped.
+static VALUE session_page_walk_cleanup(VALUE ptr) {
+    PageWalk* walk = (PageWalk*)ptr;
+    if (!NIL_P(walk->next)) {
+        int state = 0;
+        rb_protect(session_page_wait, walk->next, &state);
+        walk->next = Qnil;
+        if (state) {
+            rb_set_errinfo(Qnil);
+        }
+    }
+
+    StatementWrapper* statement_wrapper;
+    TypedData_Get_Struct(walk->statement, StatementWrapper, &statement_type, statement_wrapper);
+    if (statement_wrapper->statement != NULL) {
+        cass_statement_set_paging_state_token(statement_wrapper->statement, "", 0);
+        if (walk->page_size != 0) {
+            cass_statement_set_paging_size(statement_wrapper->statement, walk->page_size);
+            statement_wrapper->page_size = walk->page_size;
+        }
+    }
+    return Qnil;
+}
+
+// Walk the pages of `statement` starting at `first_page` (nil fetches it),
+// yielding each page or, with `rows`, passing each page's rows to the block.
+// The statement's paging state is reset afterwards; it must not be executed
+// elsewhere during the walk.
+VALUE session_each_page_from(VALUE session, VALUE statement, VALUE first_page, int rows) {
+    PageWalk walk = {session, statement, first_page, rows, Qnil, 0};
+    rb_ensure(session_page_walk, (VALUE)&walk, session_page_walk_cleanup, (VALUE)&walk);
+    RB_GC_GUARD(session);
+    RB_GC_GUARD(statement);
+    return Qnil;
+}
+
+// Yield each page of a statement's results as a Result. A String is executed
+// as a new Statement. `page_size:` sets the rows per page.
+static VALUE rb_session_each_page(int argc, VALUE* argv, VALUE self) {
+    RETURN_ENUMERATOR_KW(self, argc, argv, rb_keyword_given_p());
+
+    VALUE statement, options;
+    rb_scan_args(argc, argv, "1:", &statement, &options);
+
+    if (TYPE(statement) == T_STRING) {
+        statement = rb_class_new_instance(1, &statement, cCassStatement);
+    } else if (!rb_obj_is_kind_of(statement, cCassStatement)) {
+        rb_raise(rb_eTypeError, "Expected Statement object or query string");
+    }
+
+    // A `page_size:` only applies to this walk
+    PageWalk walk = {self, statement, Qnil, 0, Qnil, 0};
+    if (!NIL_P(options)) {
+        VALUE page_size = rb_hash_lookup2(options, ID2SYM(id_page_size), Qundef);
+        if (page_size != Qundef) {
+            int previous = statement_get(statement)->page_size;
+            rb_funcall(statement, rb_intern("page_size="), 1, page_size);
+            walk.page_size = previous;
+        }
     }
+
+    rb_ensure(session_page_walk, (VALUE)&walk, session_page_walk_cleanup, (VALUE)&walk);
+    RB_GC_GUARD(statement);
+    return self;
 }
 
 // Execute a query - convenience method that creates a statement and executes it
@@ -288,6 +943,19 @@ void Init_cassandra_c_session(VALUE module) {
     rb_define_method(cSession, "prepare", rb_session_prepare, -1);
     rb_define_method(cSession, "execute", rb_session_execute, -1);
     rb_define_method(cSession, "execute_batch", rb_session_execute_batch, -1);
+    rb_define_method(cSession, "execute_concurrent", rb_session_execute_concurrent, -1);
+    rb_define_method(cSession, "try_execute", rb_session_try_execute, -1);
+    rb_define_method(cSession, "max_in_flight", rb_session_get_max_in_flight, 0);
+    rb_define_method(cSession, "max_in_flight=", rb_session_set_max_in_flight, 1);
+    rb_define_method(cSession, "in_flight", rb_session_in_flight, 0);
     rb_define_method(cSession, "query", rb_session_query, -1);
+    rb_define_method(cSession, "each_page", rb_session_each_page, -1);
+
+    id_execute = rb_intern("execute");
+    id_get_result = rb_intern("get_result");
+    id_each = rb_intern("each");
+    id_async = rb_intern("async");
+    id_page_size = rb_intern("page_size");
+    id_wait = rb_intern("wait");
 }
- 
\ No newline at end of file
+ 
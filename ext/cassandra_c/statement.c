@@ -5,17 +5,27 @@ static void rb_statement_free(void* ptr) {
     StatementWrapper* wrapper = (StatementWrapper*)ptr;
     if (wrapper->statement != NULL) {
         cass_statement_free(wrapper->statement);
+        native_handle_freed(NATIVE_STATEMENTS);
     }
     xfree(wrapper);
 }
 
+static size_t rb_statement_memsize(const void* ptr) {
+    return sizeof(StatementWrapper);
+}
+
+static void rb_statement_mark(void* ptr) {
+    StatementWrapper* wrapper = (StatementWrapper*)ptr;
+    rb_gc_mark(wrapper->prepared);
+}
+
 // Define the Ruby data type for Statement
 const rb_data_type_t statement_type = {
     .wrap_struct_name = "CassStatement",
     .function = {
-        .dmark = NULL,
+        .dmark = rb_statement_mark,
         .dfree = rb_statement_free,
-        .dsize = NULL,
+        .dsize = rb_statement_memsize,
     },
     .data = NULL,
     .flags = RUBY_TYPED_FREE_IMMEDIATELY
@@ -25,7 +35,13 @@ const rb_data_type_t statement_type = {
 VALUE statement_new(CassStatement* statement) {
     StatementWrapper* wrapper = ALLOC(StatementWrapper);
     wrapper->statement = statement;
+    wrapper->prepared = Qnil;
+    wrapper->deadline_timeout = 0;
+    wrapper->page_size = -1;
     VALUE rb_statement = TypedData_Wrap_Struct(cCassStatement, &statement_type, wrapper);
+    if (statement != NULL) {
+        native_handle_created(NATIVE_STATEMENTS);
+    }
     return rb_statement;
 }
 
@@ -33,6 +49,9 @@ VALUE statement_new(CassStatement* statement) {
 static VALUE rb_statement_allocate(VALUE klass) {
     StatementWrapper* wrapper = ALLOC(StatementWrapper);
     wrapper->statement = NULL; // Will be set in initialize
+    wrapper->prepared = Qnil;
+    wrapper->deadline_timeout = 0;
+    wrapper->page_size = -1;
     return TypedData_Wrap_Struct(klass, &statement_type, wrapper);
 }
 
@@ -49,6 +68,8 @@ static VALUE rb_statement_initialize(int argc, VALUE* argv, VALUE self) {
     // Free any existing statement
     if (wrapper->statement != NULL) {
         cass_statement_free(wrapper->statement);
+        wrapper->statement = NULL;
+        native_handle_freed(NATIVE_STATEMENTS);
     }
     
     if (NIL_P(param_count)) {
@@ -62,15 +83,61 @@ static VALUE rb_statement_initialize(int argc, VALUE* argv, VALUE self) {
     if (!wrapper->statement) {
         rb_raise(rb_eCassandraError, "Failed to create statement");
     }
+    wrapper->deadline_timeout = 0;
+    wrapper->page_size = -1;
+    native_handle_created(NATIVE_STATEMENTS);
     
     return self;
 }
 
+// The wrapper of a Statement whose CassStatement has not been freed
+StatementWrapper* statement_get(VALUE self) {
+    StatementWrapper* wrapper;
+    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
+    if (wrapper->statement == NULL) {
+        rb_raise(rb_eCassandraError, "Statement has been freed");
+    }
+    return wrapper;
+}
 
-// Set consistency for this statement
-static VALUE rb_statement_set_consistency(VALUE self, VALUE consistency) {
+// The driver reads a statement's request timeout when it starts each request,
+// so the timeout a deadline set stays in place until the next execute, which
+// puts back the cluster's timeout when it has no deadline of its own
+void statement_apply_deadline(StatementWrapper* wrapper, cass_int64_t deadline_us, cass_uint64_t timeout_ms) {
+    if (deadline_us != FUTURE_WAIT_FOREVER) {
+        cass_statement_set_request_timeout(wrapper->statement, timeout_ms);
+        wrapper->deadline_timeout = 1;
+    } else if (wrapper->deadline_timeout) {
+        cass_statement_set_request_timeout(wrapper->statement, CASS_UINT64_MAX);
+        wrapper->deadline_timeout = 0;
+    }
+}
+
+// Free the CassStatement now rather than when the Statement is collected. Any
+// later use of the Statement raises; requests already executed are unaffected.
+// Returns nil; freeing twice is a no-op.
+static VALUE rb_statement_free_now(VALUE self) {
     StatementWrapper* wrapper;
     TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
+    if (wrapper->statement != NULL) {
+        cass_statement_free(wrapper->statement);
+        wrapper->statement = NULL;
+        native_handle_freed(NATIVE_STATEMENTS);
+    }
+    return Qnil;
+}
+
+// Whether Statement#free has been called
+static VALUE rb_statement_freed(VALUE self) {
+    StatementWrapper* wrapper;
+    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
+    return wrapper->statement == NULL ? Qtrue : Qfalse;
+}
+
+
+// Set consistency for this statement
+static VALUE rb_statement_set_consistency(VALUE self, VALUE consistency) {
+    StatementWrapper* wrapper = statement_get(self);
     
     CassConsistency consistency_value = ruby_value_to_consistency(consistency);
     
@@ -82,17 +149,55 @@ static VALUE rb_statement_set_consistency(VALUE self, VALUE consistency) {
     return self;
 }
 
+// Set the number of rows fetched per page; nil disables paging
+static VALUE rb_statement_set_page_size(VALUE self, VALUE page_size) {
+    StatementWrapper* wrapper = statement_get(self);
+
+    int size = -1;
+    if (!NIL_P(page_size)) {
+        size = NUM2INT(page_size);
+        if (size <= 0) {
+            rb_raise(rb_eArgError, "page_size must be positive or nil");
+        }
+    }
+
+    CassError error = cass_statement_set_paging_size(wrapper->statement, size);
+    if (error != CASS_OK) {
+        rb_raise(rb_eCassandraError, "Failed to set page size: %s", cass_error_desc(error));
+    }
+    wrapper->page_size = size;
+
+    return self;
+}
+
+// Resume from a token returned by Result#paging_state; nil starts from the
+// first page again
+static VALUE rb_statement_set_paging_state(VALUE self, VALUE token) {
+    StatementWrapper* wrapper = statement_get(self);
+
+    const char* data = "";
+    long length = 0;
+    if (!NIL_P(token)) {
+        StringValue(token);
+        data = RSTRING_PTR(token);
+        length = RSTRING_LEN(token);
+    }
+
+    CassError error = cass_statement_set_paging_state_token(wrapper->statement, data, (size_t)length);
+    if (error != CASS_OK) {
+        rb_raise(rb_eCassandraError, "Failed to set paging state: %s", cass_error_desc(error));
+    }
+
+    RB_GC_GUARD(token);
+    return self;
+}
+
 // Bind a value by index with optional type hint
 static VALUE rb_statement_bind_by_index(int argc, VALUE* argv, VALUE self) {
     VALUE index, value, type_hint;
     rb_scan_args(argc, argv, "21", &index, &value, &type_hint);
     
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error;
@@ -118,12 +223,7 @@ static VALUE rb_statement_bind_by_name(int argc, VALUE* argv, VALUE self) {
     VALUE name, value, type_hint;
     rb_scan_args(argc, argv, "21", &name, &value, &type_hint);
     
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -147,12 +247,7 @@ static VALUE rb_statement_bind_by_name(int argc, VALUE* argv, VALUE self) {
 
 // Bind a text/varchar value by index (UTF-8 strings)
 static VALUE rb_statement_bind_text_by_index(VALUE self, VALUE index, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error = ruby_string_to_cass_text(wrapper->statement, param_index, value);
@@ -167,12 +262,7 @@ static VALUE rb_statement_bind_text_by_index(VALUE self, VALUE index, VALUE valu
 
 // Bind a text/varchar value by name (UTF-8 strings)
 static VALUE rb_statement_bind_text_by_name(VALUE self, VALUE name, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -188,12 +278,7 @@ static VALUE rb_statement_bind_text_by_name(VALUE self, VALUE name, VALUE value)
 
 // Bind an ASCII value by index (ASCII-only strings)
 static VALUE rb_statement_bind_ascii_by_index(VALUE self, VALUE index, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error = ruby_string_to_cass_ascii(wrapper->statement, param_index, value);
@@ -212,12 +297,7 @@ static VALUE rb_statement_bind_ascii_by_index(VALUE self, VALUE index, VALUE val
 
 // Bind an ASCII value by name (ASCII-only strings)
 static VALUE rb_statement_bind_ascii_by_name(VALUE self, VALUE name, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -237,12 +317,7 @@ static VALUE rb_statement_bind_ascii_by_name(VALUE self, VALUE name, VALUE value
 
 // Bind a blob value by index (binary data)
 static VALUE rb_statement_bind_blob_by_index(VALUE self, VALUE index, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error = ruby_string_to_cass_blob(wrapper->statement, param_index, value);
@@ -257,12 +332,7 @@ static VALUE rb_statement_bind_blob_by_index(VALUE self, VALUE index, VALUE valu
 
 // Bind a blob value by name (binary data)
 static VALUE rb_statement_bind_blob_by_name(VALUE self, VALUE name, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -278,12 +348,7 @@ static VALUE rb_statement_bind_blob_by_name(VALUE self, VALUE name, VALUE value)
 
 // Bind an inet value by index (IP addresses)
 static VALUE rb_statement_bind_inet_by_index(VALUE self, VALUE index, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error = ruby_value_to_cass_inet(wrapper->statement, param_index, value);
@@ -298,12 +363,7 @@ static VALUE rb_statement_bind_inet_by_index(VALUE self, VALUE index, VALUE valu
 
 // Bind an inet value by name (IP addresses)
 static VALUE rb_statement_bind_inet_by_name(VALUE self, VALUE name, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -319,12 +379,7 @@ static VALUE rb_statement_bind_inet_by_name(VALUE self, VALUE name, VALUE value)
 
 // Bind a float value by index (32-bit IEEE 754)
 static VALUE rb_statement_bind_float_by_index(VALUE self, VALUE index, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error = ruby_value_to_cass_float(wrapper->statement, param_index, value);
@@ -339,12 +394,7 @@ static VALUE rb_statement_bind_float_by_index(VALUE self, VALUE index, VALUE val
 
 // Bind a float value by name (32-bit IEEE 754)
 static VALUE rb_statement_bind_float_by_name(VALUE self, VALUE name, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -360,12 +410,7 @@ static VALUE rb_statement_bind_float_by_name(VALUE self, VALUE name, VALUE value
 
 // Bind a double value by index (64-bit IEEE 754)
 static VALUE rb_statement_bind_double_by_index(VALUE self, VALUE index, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error = ruby_value_to_cass_double(wrapper->statement, param_index, value);
@@ -380,12 +425,7 @@ static VALUE rb_statement_bind_double_by_index(VALUE self, VALUE index, VALUE va
 
 // Bind a double value by name (64-bit IEEE 754)
 static VALUE rb_statement_bind_double_by_name(VALUE self, VALUE name, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -401,12 +441,7 @@ static VALUE rb_statement_bind_double_by_name(VALUE self, VALUE name, VALUE valu
 
 // Bind a decimal value by index (arbitrary precision decimal)
 static VALUE rb_statement_bind_decimal_by_index(VALUE self, VALUE index, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error = ruby_value_to_cass_decimal(wrapper->statement, param_index, value);
@@ -421,12 +456,7 @@ static VALUE rb_statement_bind_decimal_by_index(VALUE self, VALUE index, VALUE v
 
 // Bind a decimal value by name (arbitrary precision decimal)
 static VALUE rb_statement_bind_decimal_by_name(VALUE self, VALUE name, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -442,12 +472,7 @@ static VALUE rb_statement_bind_decimal_by_name(VALUE self, VALUE name, VALUE val
 
 // Bind a UUID value by index
 static VALUE rb_statement_bind_uuid_by_index(VALUE self, VALUE index, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error = ruby_value_to_cass_uuid(wrapper->statement, param_index, value);
@@ -462,12 +487,7 @@ static VALUE rb_statement_bind_uuid_by_index(VALUE self, VALUE index, VALUE valu
 
 // Bind a UUID value by name
 static VALUE rb_statement_bind_uuid_by_name(VALUE self, VALUE name, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -483,12 +503,7 @@ static VALUE rb_statement_bind_uuid_by_name(VALUE self, VALUE name, VALUE value)
 
 // Bind a TimeUUID value by index
 static VALUE rb_statement_bind_timeuuid_by_index(VALUE self, VALUE index, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error = ruby_value_to_cass_timeuuid(wrapper->statement, param_index, value);
@@ -503,12 +518,7 @@ static VALUE rb_statement_bind_timeuuid_by_index(VALUE self, VALUE index, VALUE
 
 // Bind a TimeUUID value by name
 static VALUE rb_statement_bind_timeuuid_by_name(VALUE self, VALUE name, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -524,12 +534,7 @@ static VALUE rb_statement_bind_timeuuid_by_name(VALUE self, VALUE name, VALUE va
 
 // Bind a date value by index
 static VALUE rb_statement_bind_date_by_index(VALUE self, VALUE index, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error = ruby_value_to_cass_date(wrapper->statement, param_index, value);
@@ -544,12 +549,7 @@ static VALUE rb_statement_bind_date_by_index(VALUE self, VALUE index, VALUE valu
 
 // Bind a date value by name
 static VALUE rb_statement_bind_date_by_name(VALUE self, VALUE name, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -565,12 +565,7 @@ static VALUE rb_statement_bind_date_by_name(VALUE self, VALUE name, VALUE value)
 
 // Bind a time value by index
 static VALUE rb_statement_bind_time_by_index(VALUE self, VALUE index, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error = ruby_value_to_cass_time(wrapper->statement, param_index, value);
@@ -585,12 +580,7 @@ static VALUE rb_statement_bind_time_by_index(VALUE self, VALUE index, VALUE valu
 
 // Bind a time value by name
 static VALUE rb_statement_bind_time_by_name(VALUE self, VALUE name, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -606,12 +596,7 @@ static VALUE rb_statement_bind_time_by_name(VALUE self, VALUE name, VALUE value)
 
 // Bind a timestamp value by index
 static VALUE rb_statement_bind_timestamp_by_index(VALUE self, VALUE index, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error = ruby_value_to_cass_timestamp(wrapper->statement, param_index, value);
@@ -626,12 +611,7 @@ static VALUE rb_statement_bind_timestamp_by_index(VALUE self, VALUE index, VALUE
 
 // Bind a timestamp value by name
 static VALUE rb_statement_bind_timestamp_by_name(VALUE self, VALUE name, VALUE value) {
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -652,12 +632,7 @@ static VALUE rb_statement_bind_list_by_index(int argc, VALUE* argv, VALUE self)
     VALUE index, value, element_type;
     rb_scan_args(argc, argv, "21", &index, &value, &element_type);
     
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error;
@@ -683,12 +658,7 @@ static VALUE rb_statement_bind_list_by_name(int argc, VALUE* argv, VALUE self) {
     VALUE name, value, element_type;
     rb_scan_args(argc, argv, "21", &name, &value, &element_type);
     
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -715,12 +685,7 @@ static VALUE rb_statement_bind_set_by_index(int argc, VALUE* argv, VALUE self) {
     VALUE index, value, element_type;
     rb_scan_args(argc, argv, "21", &index, &value, &element_type);
     
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error;
@@ -746,12 +711,7 @@ static VALUE rb_statement_bind_set_by_name(int argc, VALUE* argv, VALUE self) {
     VALUE name, value, element_type;
     rb_scan_args(argc, argv, "21", &name, &value, &element_type);
     
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -778,12 +738,7 @@ static VALUE rb_statement_bind_map_by_index(int argc, VALUE* argv, VALUE self) {
     VALUE index, value, key_type, value_type;
     rb_scan_args(argc, argv, "22", &index, &value, &key_type, &value_type);
     
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     size_t param_index = NUM2SIZET(index);
     CassError error;
@@ -809,12 +764,7 @@ static VALUE rb_statement_bind_map_by_name(int argc, VALUE* argv, VALUE self) {
     VALUE name, value, key_type, value_type;
     rb_scan_args(argc, argv, "22", &name, &value, &key_type, &value_type);
     
-    StatementWrapper* wrapper;
-    TypedData_Get_Struct(self, StatementWrapper, &statement_type, wrapper);
-    
-    if (wrapper->statement == NULL) {
-        rb_raise(rb_eCassandraError, "Statement is NULL");
-    }
+    StatementWrapper* wrapper = statement_get(self);
     
     Check_Type(name, T_STRING);
     const char* param_name = StringValueCStr(name);
@@ -844,6 +794,10 @@ void Init_cassandra_c_statement(VALUE module) {
     rb_define_alloc_func(cCassStatement, rb_statement_allocate);
     rb_define_method(cCassStatement, "initialize", rb_statement_initialize, -1);
     rb_define_method(cCassStatement, "consistency=", rb_statement_set_consistency, 1);
+    rb_define_method(cCassStatement, "page_size=", rb_statement_set_page_size, 1);
+    rb_define_method(cCassStatement, "paging_state=", rb_statement_set_paging_state, 1);
+    rb_define_method(cCassStatement, "free", rb_statement_free_now, 0);
+    rb_define_method(cCassStatement, "freed?", rb_statement_freed, 0);
     rb_define_method(cCassStatement, "bind_by_index", rb_statement_bind_by_index, -1);
     rb_define_method(cCassStatement, "bind_by_name", rb_statement_bind_by_name, -1);
     
@@ -28,7 +28,8 @@ static const rb_data_type_t timeuuid_type = {
 // Global UUID generator (thread-safe according to C driver docs)
 static CassUuidGen* global_uuid_gen = NULL;
 
-// Initialize global UUID generator
+// Initialize global UUID generator. Called once from Init so no Ractor or
+// thread can race on the lazy initialization.
 static void init_uuid_generator() {
     if (global_uuid_gen == NULL) {
         global_uuid_gen = cass_uuid_gen_new();
@@ -62,8 +63,6 @@ static VALUE rb_timeuuid_initialize(int argc, VALUE* argv, VALUE self) {
     TimeUuidWrapper* wrapper;
     TypedData_Get_Struct(self, TimeUuidWrapper, &timeuuid_type, wrapper);
     
-    init_uuid_generator();
-    
     if (NIL_P(time_value)) {
         // Generate TimeUUID for current time
         cass_uuid_gen_time(global_uuid_gen, &wrapper->uuid);
@@ -119,10 +118,7 @@ static VALUE rb_timeuuid_to_s(VALUE self) {
     TimeUuidWrapper* wrapper;
     TypedData_Get_Struct(self, TimeUuidWrapper, &timeuuid_type, wrapper);
     
-    char uuid_str[CASS_UUID_STRING_LENGTH];
-    cass_uuid_string(wrapper->uuid, uuid_str);
-    
-    return rb_str_new_cstr(uuid_str);
+    return uuid_to_rb_str(wrapper->uuid);
 }
 
 // Extract timestamp from TimeUUID
@@ -213,8 +209,7 @@ CassUuid rb_timeuuid_get_cass_uuid(VALUE timeuuid_obj) {
 
 // Create Ruby TimeUuid object from CassUuid (for result parsing)
 VALUE rb_timeuuid_from_cass_uuid(CassUuid uuid) {
-    VALUE klass = rb_const_get(mCassandraCNative, rb_intern("TimeUuid"));
-    VALUE instance = rb_timeuuid_allocate(klass);
+    VALUE instance = rb_timeuuid_allocate(cCassTimeUuid);
     
     TimeUuidWrapper* wrapper;
     TypedData_Get_Struct(instance, TimeUuidWrapper, &timeuuid_type, wrapper);
@@ -226,6 +221,7 @@ VALUE rb_timeuuid_from_cass_uuid(CassUuid uuid) {
 // Initialize the TimeUuid class
 VALUE cCassTimeUuid;
 void Init_cassandra_c_timeuuid(VALUE module) {
+    init_uuid_generator();
     cCassTimeUuid = rb_define_class_under(module, "TimeUuid", rb_cObject);
     
     rb_define_alloc_func(cCassTimeUuid, rb_timeuuid_allocate);
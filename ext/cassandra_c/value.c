@@ -1,13 +1,16 @@
 #include "cassandra_c.h"
 #include <string.h>
 #include "ruby/encoding.h"
+#ifdef HAVE_RUBY_IO_BUFFER_H
+#include "ruby/io/buffer.h"
+#endif
 
 // No wrapper classes needed - using native Ruby types
 
 
 // Forward declarations
 static VALUE ruby_decimal_from_varint(const cass_byte_t* varint, size_t varint_size, cass_int32_t scale);
-static void ruby_integer_to_varint_bytes(VALUE integer, cass_byte_t** varint_bytes, size_t* varint_size);
+static VALUE ruby_integer_to_varint(VALUE integer);
 static VALUE ruby_varint_bytes_to_integer(const cass_byte_t* varint, size_t varint_size);
 
 // No initialization needed for native Ruby types
@@ -246,223 +249,485 @@ CassError ruby_value_to_cass_statement_by_name(CassStatement* statement, const c
     }
 }
 
-// Helper function to convert a CassValue to a Ruby object
-VALUE cass_value_to_ruby(const CassValue* value) {
-    if (value == NULL || cass_value_is_null(value)) {
-        return Qnil;
+// ============================================================================
+// UUID formatting
+// ============================================================================
+
+// "00" through "ff", indexed by byte value * 2; filled once at Init
+static char hex_pairs[512];
+
+// Bytes of a CassUuid in RFC 4122 (network) order
+static void uuid_to_bytes(CassUuid uuid, unsigned char* bytes) {
+    cass_uint64_t time_and_version = uuid.time_and_version;
+    bytes[0] = (unsigned char)(time_and_version >> 24);    // time_low
+    bytes[1] = (unsigned char)(time_and_version >> 16);
+    bytes[2] = (unsigned char)(time_and_version >> 8);
+    bytes[3] = (unsigned char)time_and_version;
+    bytes[4] = (unsigned char)(time_and_version >> 40);    // time_mid
+    bytes[5] = (unsigned char)(time_and_version >> 32);
+    bytes[6] = (unsigned char)(time_and_version >> 56);    // time_hi_and_version
+    bytes[7] = (unsigned char)(time_and_version >> 48);
+    for (int i = 0; i < 8; i++) {
+        bytes[8 + i] = (unsigned char)(uuid.clock_seq_and_node >> (56 - 8 * i));
     }
-    
-    CassValueType type = cass_value_type(value);
-    VALUE rb_value = Qnil;
-    
+}
+
+static CassUuid uuid_from_bytes(const unsigned char* bytes) {
+    CassUuid uuid;
+    uuid.time_and_version = ((cass_uint64_t)bytes[0] << 24) | ((cass_uint64_t)bytes[1] << 16) |
+                            ((cass_uint64_t)bytes[2] << 8) | (cass_uint64_t)bytes[3] |
+                            ((cass_uint64_t)bytes[4] << 40) | ((cass_uint64_t)bytes[5] << 32) |
+                            ((cass_uint64_t)bytes[6] << 56) | ((cass_uint64_t)bytes[7] << 48);
+    uuid.clock_seq_and_node = 0;
+    for (int i = 0; i < 8; i++) {
+        uuid.clock_seq_and_node = (uuid.clock_seq_and_node << 8) | bytes[8 + i];
+    }
+    return uuid;
+}
+
+// Format 16 UUID bytes as canonical text, two hex digits per table lookup
+static VALUE uuid_bytes_to_rb_str(const unsigned char* bytes) {
+    VALUE str = rb_usascii_str_new(NULL, CASS_UUID_STRING_LENGTH - 1);
+    char* out = RSTRING_PTR(str);
+    for (int i = 0; i < 16; i++) {
+        if (i == 4 || i == 6 || i == 8 || i == 10) {
+            *out++ = '-';
+        }
+        memcpy(out, &hex_pairs[bytes[i] * 2], 2);
+        out += 2;
+    }
+    return str;
+}
+
+VALUE uuid_to_rb_str(CassUuid uuid) {
+    unsigned char bytes[16];
+    uuid_to_bytes(uuid, bytes);
+    return uuid_bytes_to_rb_str(bytes);
+}
+
+// CassandraC::Native.format_uuid(bytes): canonical text for a binary UUID as
+// returned by Result#binary_ids
+static VALUE rb_native_format_uuid(VALUE self, VALUE bytes) {
+    StringValue(bytes);
+    if (RSTRING_LEN(bytes) != 16) {
+        rb_raise(rb_eArgError, "UUID must be 16 bytes, got %ld", RSTRING_LEN(bytes));
+    }
+    return uuid_bytes_to_rb_str((const unsigned char*)RSTRING_PTR(bytes));
+}
+
+// ============================================================================
+// Decoding
+// ============================================================================
+
+// Classes and method IDs used while decoding, resolved once at Init
+static VALUE cDate;
+static VALUE cSet;
+static VALUE cTypesTime;    // CassandraC::Types::Time, defined by the Ruby library after Init
+static VALUE cBigDecimal;
+static ID id_new;
+static ID id_jd;
+static ID id_iv_nanoseconds;
+static ID id_BigDecimal;
+static ID id_split;
+
+// Julian Day Number of 1970-01-01; CQL dates are days relative to it
+#define UNIX_EPOCH_JD 2440588
+
+// CassandraC::Types::Time is defined in Ruby after the extension loads, so it
+// is resolved on first use
+static VALUE types_time_class(void) {
+    if (!RTEST(cTypesTime)) {
+        VALUE types = rb_const_get(mCassandraC, rb_intern("Types"));
+        cTypesTime = rb_const_get(types, rb_intern("Time"));
+    }
+    return cTypesTime;
+}
+
+// Each decoder converts one non-null value of a single CQL type. Results look
+// up a decoder per column once (see value_decoder_for) instead of switching
+// on the type of every cell.
+
+static VALUE decode_text(const CassValue* value) {
+    const char* text;
+    size_t text_length;
+    cass_value_get_string(value, &text, &text_length);
+    return rb_utf8_str_new(text, (long)text_length);
+}
+
+// Text as a frozen String from Ruby's fstring table (Result#intern_columns):
+// repeated values share one object and allocate nothing after the first
+static VALUE decode_text_interned(const CassValue* value) {
+    const char* text;
+    size_t text_length;
+    cass_value_get_string(value, &text, &text_length);
+    return rb_enc_interned_str(text, (long)text_length, rb_utf8_encoding());
+}
+
+static VALUE decode_tiny_int(const CassValue* value) {
+    cass_int8_t i8;
+    cass_value_get_int8(value, &i8);
+    return INT2FIX(i8);
+}
+
+static VALUE decode_small_int(const CassValue* value) {
+    cass_int16_t i16;
+    cass_value_get_int16(value, &i16);
+    return INT2FIX(i16);
+}
+
+static VALUE decode_int(const CassValue* value) {
+    cass_int32_t i32;
+    cass_value_get_int32(value, &i32);
+    return LONG2NUM(i32);
+}
+
+static VALUE decode_bigint(const CassValue* value) {
+    cass_int64_t i64;
+    cass_value_get_int64(value, &i64);
+    return LL2NUM(i64);
+}
+
+static VALUE decode_varint(const CassValue* value) {
+    const cass_byte_t* varint;
+    size_t varint_size;
+    cass_value_get_bytes(value, &varint, &varint_size);
+    return ruby_varint_bytes_to_integer(varint, varint_size);
+}
+
+static VALUE decode_boolean(const CassValue* value) {
+    cass_bool_t b;
+    cass_value_get_bool(value, &b);
+    return b ? Qtrue : Qfalse;
+}
+
+static VALUE decode_double(const CassValue* value) {
+    cass_double_t d;
+    cass_value_get_double(value, &d);
+    return rb_float_new(d);
+}
+
+static VALUE decode_float(const CassValue* value) {
+    cass_float_t f;
+    cass_value_get_float(value, &f);
+    return rb_float_new(f);
+}
+
+static VALUE decode_decimal(const CassValue* value) {
+    const cass_byte_t* varint;
+    size_t varint_size;
+    cass_int32_t scale;
+    cass_value_get_decimal(value, &varint, &varint_size, &scale);
+    return ruby_decimal_from_varint(varint, varint_size, scale);
+}
+
+static VALUE decode_uuid(const CassValue* value) {
+    CassUuid uuid;
+    cass_value_get_uuid(value, &uuid);
+    return uuid_to_rb_str(uuid);
+}
+
+static VALUE decode_timeuuid(const CassValue* value) {
+    CassUuid timeuuid;
+    cass_value_get_uuid(value, &timeuuid);
+    return rb_timeuuid_from_cass_uuid(timeuuid);
+}
+
+// UUID and TimeUUID as a frozen 16-byte binary String (Result#binary_ids)
+static VALUE decode_uuid_binary(const CassValue* value) {
+    CassUuid uuid;
+    cass_value_get_uuid(value, &uuid);
+    unsigned char bytes[16];
+    uuid_to_bytes(uuid, bytes);
+    return rb_obj_freeze(rb_str_new((const char*)bytes, sizeof(bytes)));
+}
+
+static VALUE decode_blob(const CassValue* value) {
+    const cass_byte_t* bytes;
+    size_t bytes_length;
+    cass_value_get_bytes(value, &bytes, &bytes_length);
+    return rb_enc_str_new((const char*)bytes, (long)bytes_length, rb_ascii8bit_encoding());
+}
+
+// Blob as a read-only IO::Buffer over the result's own memory. The caller
+// must keep the Result alive for as long as the buffer (see
+// result_decode_cell).
+VALUE value_blob_view(const CassValue* value) {
+#ifdef HAVE_RUBY_IO_BUFFER_H
+    const cass_byte_t* bytes;
+    size_t bytes_length;
+    cass_value_get_bytes(value, &bytes, &bytes_length);
+    return rb_io_buffer_new((void*)bytes, bytes_length, RB_IO_BUFFER_EXTERNAL | RB_IO_BUFFER_READONLY);
+#else
+    rb_raise(rb_eNotImpError, "Blob views require IO::Buffer (Ruby 3.1+)");
+#endif
+}
+
+// Detach a view from the row data it points into, which is about to be freed;
+// later reads of the view raise
+void value_blob_view_release(VALUE view) {
+#ifdef HAVE_RUBY_IO_BUFFER_H
+    rb_io_buffer_free(view);
+#endif
+}
+
+int value_blob_views_supported(void) {
+#ifdef HAVE_RUBY_IO_BUFFER_H
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+static VALUE decode_inet(const CassValue* value) {
+    CassInet inet;
+    cass_value_get_inet(value, &inet);
+    char inet_str[CASS_INET_STRING_LENGTH];
+    cass_inet_string(inet, inet_str);
+    return rb_str_new_cstr(inet_str);
+}
+
+// Inet as a frozen 4- or 16-byte binary String (Result#binary_ids)
+static VALUE decode_inet_binary(const CassValue* value) {
+    CassInet inet;
+    cass_value_get_inet(value, &inet);
+    return rb_obj_freeze(rb_str_new((const char*)inet.address, inet.address_length));
+}
+
+typedef struct {
+    VALUE collected;        // Array or Hash being filled
+    CassIterator* iterator;
+} CollectionDecode;
+
+static VALUE decode_elements_body(VALUE ptr) {
+    CollectionDecode* decode = (CollectionDecode*)ptr;
+    while (cass_iterator_next(decode->iterator)) {
+        rb_ary_push(decode->collected, cass_value_to_ruby(cass_iterator_get_value(decode->iterator)));
+    }
+    return decode->collected;
+}
+
+static VALUE decode_map_body(VALUE ptr) {
+    CollectionDecode* decode = (CollectionDecode*)ptr;
+    while (cass_iterator_next(decode->iterator)) {
+        VALUE key = cass_value_to_ruby(cass_iterator_get_map_key(decode->iterator));
+        VALUE val = cass_value_to_ruby(cass_iterator_get_map_value(decode->iterator));
+        rb_hash_aset(decode->collected, key, val);
+    }
+    return decode->collected;
+}
+
+static VALUE decode_collection_cleanup(VALUE ptr) {
+    cass_iterator_free(((CollectionDecode*)ptr)->iterator);
+    return Qnil;
+}
+
+// Elements are decoded by their own type. The iterator is freed even if an
+// element fails to decode.
+static VALUE decode_elements(const CassValue* value) {
+    CollectionDecode decode;
+    decode.collected = rb_ary_new_capa((long)cass_value_item_count(value));
+    decode.iterator = cass_iterator_from_collection(value);
+    return rb_ensure(decode_elements_body, (VALUE)&decode, decode_collection_cleanup, (VALUE)&decode);
+}
+
+static VALUE decode_list(const CassValue* value) {
+    return decode_elements(value);
+}
+
+static VALUE decode_set(const CassValue* value) {
+    return rb_funcall(cSet, id_new, 1, decode_elements(value));
+}
+
+static VALUE decode_map(const CassValue* value) {
+    CollectionDecode decode;
+    decode.collected = rb_hash_new();
+    decode.iterator = cass_iterator_from_map(value);
+    return rb_ensure(decode_map_body, (VALUE)&decode, decode_collection_cleanup, (VALUE)&decode);
+}
+
+static VALUE decode_date(const CassValue* value) {
+    cass_uint32_t date_days;
+    cass_value_get_uint32(value, &date_days);
+
+    // Days since Unix epoch map straight onto a Julian Day Number
+    return rb_funcall(cDate, id_jd, 1, LL2NUM((long long)date_days + UNIX_EPOCH_JD));
+}
+
+static VALUE decode_time(const CassValue* value) {
+    cass_int64_t time_ns;
+    cass_value_get_int64(value, &time_ns);
+
+    // CassandraC::Types::Time (nanoseconds since midnight)
+    return rb_funcall(types_time_class(), id_new, 1, LL2NUM(time_ns));
+}
+
+static VALUE decode_timestamp(const CassValue* value) {
+    cass_int64_t timestamp_ms;
+    cass_value_get_int64(value, &timestamp_ms);
+
+    // Milliseconds since Unix epoch, floored so pre-epoch values keep a
+    // non-negative sub-second part
+    struct timespec ts;
+    cass_int64_t seconds = timestamp_ms / 1000;
+    cass_int64_t millis = timestamp_ms % 1000;
+    if (millis < 0) {
+        seconds -= 1;
+        millis += 1000;
+    }
+    ts.tv_sec = (time_t)seconds;
+    ts.tv_nsec = (long)millis * 1000000L;
+    return rb_time_timespec_new(&ts, INT_MAX);    // INT_MAX: local time, as Time.at
+}
+
+static VALUE decode_unsupported(const CassValue* value) {
+    return rb_str_new_cstr("[unsupported type]");
+}
+
+// Decoder for values of `type`
+ValueDecoderFn value_decoder_for(CassValueType type) {
     switch (type) {
         case CASS_VALUE_TYPE_ASCII:
         case CASS_VALUE_TYPE_TEXT:
-        case CASS_VALUE_TYPE_VARCHAR: {
-            const char* text;
-            size_t text_length;
-            cass_value_get_string(value, &text, &text_length);
-            rb_value = rb_str_new(text, text_length);
-            rb_enc_associate(rb_value, rb_utf8_encoding());
-            break;
-        }
-        case CASS_VALUE_TYPE_TINY_INT: {
-            cass_int8_t i8;
-            cass_value_get_int8(value, &i8);
-            rb_value = INT2NUM(i8);
-            break;
-        }
-        case CASS_VALUE_TYPE_SMALL_INT: {
-            cass_int16_t i16;
-            cass_value_get_int16(value, &i16);
-            rb_value = INT2NUM(i16);
-            break;
-        }
-        case CASS_VALUE_TYPE_INT: {
-            cass_int32_t i32;
-            cass_value_get_int32(value, &i32);
-            rb_value = LONG2NUM(i32);
-            break;
-        }
+        case CASS_VALUE_TYPE_VARCHAR:
+            return decode_text;
+        case CASS_VALUE_TYPE_TINY_INT:
+            return decode_tiny_int;
+        case CASS_VALUE_TYPE_SMALL_INT:
+            return decode_small_int;
+        case CASS_VALUE_TYPE_INT:
+            return decode_int;
         case CASS_VALUE_TYPE_BIGINT:
-        case CASS_VALUE_TYPE_COUNTER: {
-            cass_int64_t i64;
-            cass_value_get_int64(value, &i64);
-            rb_value = LL2NUM(i64);
-            break;
-        }
-        case CASS_VALUE_TYPE_VARINT: {
-            // VARINT values can be retrieved as string for simplicity
-            const char* text;
-            size_t text_length;
-            cass_value_get_string(value, &text, &text_length);
-            VALUE str_val = rb_str_new(text, text_length);
-            rb_value = rb_funcall(str_val, rb_intern("to_i"), 0);
-            break;
-        }
-        case CASS_VALUE_TYPE_BOOLEAN: {
-            cass_bool_t b;
-            cass_value_get_bool(value, &b);
-            rb_value = b ? Qtrue : Qfalse;
-            break;
-        }
-        case CASS_VALUE_TYPE_DOUBLE: {
-            cass_double_t d;
-            cass_value_get_double(value, &d);
-            rb_value = rb_float_new(d);
-            break;
-        }
-        case CASS_VALUE_TYPE_FLOAT: {
-            cass_float_t f;
-            cass_value_get_float(value, &f);
-            rb_value = rb_float_new(f);
-            break;
-        }
-        case CASS_VALUE_TYPE_DECIMAL: {
-            const cass_byte_t* varint;
-            size_t varint_size;
-            cass_int32_t scale;
-            cass_value_get_decimal(value, &varint, &varint_size, &scale);
-            
-            // Convert varint bytes to Ruby BigDecimal
-            rb_value = ruby_decimal_from_varint(varint, varint_size, scale);
-            break;
-        }
-        case CASS_VALUE_TYPE_UUID: {
-            CassUuid uuid;
-            cass_value_get_uuid(value, &uuid);
-            char uuid_str[CASS_UUID_STRING_LENGTH];
-            cass_uuid_string(uuid, uuid_str);
-            
-            // Return as regular Ruby string
-            rb_value = rb_str_new_cstr(uuid_str);
-            break;
-        }
-        case CASS_VALUE_TYPE_TIMEUUID: {
-            CassUuid timeuuid;
-            cass_value_get_uuid(value, &timeuuid);
-            
-            // Return as CassandraC::Native::TimeUuid object
-            rb_value = rb_timeuuid_from_cass_uuid(timeuuid);
-            break;
-        }
-        case CASS_VALUE_TYPE_BLOB: {
-            const cass_byte_t* bytes;
-            size_t bytes_length;
-            cass_value_get_bytes(value, &bytes, &bytes_length);
-            rb_value = rb_str_new((const char*)bytes, bytes_length);
-            // Set encoding to ASCII-8BIT (binary) for blob data
-            rb_enc_associate(rb_value, rb_ascii8bit_encoding());
-            break;
-        }
-        case CASS_VALUE_TYPE_INET: {
-            CassInet inet;
-            cass_value_get_inet(value, &inet);
-            char inet_str[CASS_INET_STRING_LENGTH];
-            cass_inet_string(inet, inet_str);
-            rb_value = rb_str_new_cstr(inet_str);
-            break;
-        }
-        case CASS_VALUE_TYPE_LIST: {
-            // Create a Ruby array to hold the list elements
-            VALUE rb_array = rb_ary_new();
-            
-            // Get an iterator for the collection
-            CassIterator* iterator = cass_iterator_from_collection(value);
-            
-            // Iterate through each element and convert to Ruby
-            while (cass_iterator_next(iterator)) {
-                const CassValue* element = cass_iterator_get_value(iterator);
-                VALUE rb_element = cass_value_to_ruby(element);
-                rb_ary_push(rb_array, rb_element);
-            }
-            
-            cass_iterator_free(iterator);
-            
-            // Return plain Ruby array
-            rb_value = rb_array;
-            break;
-        }
-        case CASS_VALUE_TYPE_SET: {
-            // Create a Ruby array to hold the set elements, then convert to Set
-            VALUE rb_array = rb_ary_new();
-            
-            // Get an iterator for the collection
-            CassIterator* iterator = cass_iterator_from_collection(value);
-            
-            // Iterate through each element and convert to Ruby
-            while (cass_iterator_next(iterator)) {
-                const CassValue* element = cass_iterator_get_value(iterator);
-                VALUE rb_element = cass_value_to_ruby(element);
-                rb_ary_push(rb_array, rb_element);
-            }
-            
-            cass_iterator_free(iterator);
-            
-            // Convert array to Ruby Set
-            VALUE set_class = rb_const_get(rb_cObject, rb_intern("Set"));
-            rb_value = rb_funcall(set_class, rb_intern("new"), 1, rb_array);
-            break;
-        }
-        case CASS_VALUE_TYPE_MAP: {
-            // Create a Ruby hash to hold the map elements
-            VALUE rb_hash = rb_hash_new();
-            
-            // Get an iterator for the map
-            CassIterator* iterator = cass_iterator_from_map(value);
-            
-            // Iterate through each key-value pair and convert to Ruby
-            while (cass_iterator_next(iterator)) {
-                const CassValue* key = cass_iterator_get_map_key(iterator);
-                const CassValue* val = cass_iterator_get_map_value(iterator);
-                VALUE rb_key = cass_value_to_ruby(key);
-                VALUE rb_val = cass_value_to_ruby(val);
-                rb_hash_aset(rb_hash, rb_key, rb_val);
-            }
-            
-            cass_iterator_free(iterator);
-            
-            // Return Ruby hash
-            rb_value = rb_hash;
-            break;
-        }
-        case CASS_VALUE_TYPE_DATE: {
-            cass_uint32_t date_days;
-            cass_value_get_uint32(value, &date_days);
-            
-            // Convert Cassandra date (days since Unix epoch) to Ruby Date
-            VALUE date_class = rb_const_get(rb_cObject, rb_intern("Date"));
-            VALUE epoch_date = rb_funcall(date_class, rb_intern("new"), 3, INT2NUM(1970), INT2NUM(1), INT2NUM(1));
-            rb_value = rb_funcall(epoch_date, rb_intern("+"), 1, UINT2NUM(date_days));
-            break;
-        }
-        case CASS_VALUE_TYPE_TIME: {
-            cass_int64_t time_ns;
-            cass_value_get_int64(value, &time_ns);
-            
-            // Return as CassandraC::Types::Time object (nanoseconds since midnight)
-            VALUE mTypes = rb_const_get(mCassandraC, rb_intern("Types"));
-            VALUE time_class = rb_const_get(mTypes, rb_intern("Time"));
-            rb_value = rb_funcall(time_class, rb_intern("from_nanoseconds_since_midnight"), 1, LL2NUM(time_ns));
-            break;
-        }
-        case CASS_VALUE_TYPE_TIMESTAMP: {
-            cass_int64_t timestamp_ms;
-            cass_value_get_int64(value, &timestamp_ms);
-            
-            // Convert milliseconds since Unix epoch to Ruby Time
-            double timestamp_seconds = (double)timestamp_ms / 1000.0;
-            VALUE time_class = rb_const_get(rb_cObject, rb_intern("Time"));
-            rb_value = rb_funcall(time_class, rb_intern("at"), 1, rb_float_new(timestamp_seconds));
-            break;
-        }
+        case CASS_VALUE_TYPE_COUNTER:
+            return decode_bigint;
+        case CASS_VALUE_TYPE_VARINT:
+            return decode_varint;
+        case CASS_VALUE_TYPE_BOOLEAN:
+            return decode_boolean;
+        case CASS_VALUE_TYPE_DOUBLE:
+            return decode_double;
+        case CASS_VALUE_TYPE_FLOAT:
+            return decode_float;
+        case CASS_VALUE_TYPE_DECIMAL:
+            return decode_decimal;
+        case CASS_VALUE_TYPE_UUID:
+            return decode_uuid;
+        case CASS_VALUE_TYPE_TIMEUUID:
+            return decode_timeuuid;
+        case CASS_VALUE_TYPE_BLOB:
+            return decode_blob;
+        case CASS_VALUE_TYPE_INET:
+            return decode_inet;
+        case CASS_VALUE_TYPE_LIST:
+            return decode_list;
+        case CASS_VALUE_TYPE_SET:
+            return decode_set;
+        case CASS_VALUE_TYPE_MAP:
+            return decode_map;
+        case CASS_VALUE_TYPE_DATE:
+            return decode_date;
+        case CASS_VALUE_TYPE_TIME:
+            return decode_time;
+        case CASS_VALUE_TYPE_TIMESTAMP:
+            return decode_timestamp;
         // Add other data types as needed
         default:
-            rb_value = rb_str_new_cstr("[unsupported type]");
-            break;
+            return decode_unsupported;
     }
-    
-    return rb_value;
+}
+
+// Decoder for Result#intern_columns, or NULL for non-text types
+ValueDecoderFn value_interned_decoder_for(CassValueType type) {
+    switch (type) {
+        case CASS_VALUE_TYPE_ASCII:
+        case CASS_VALUE_TYPE_TEXT:
+        case CASS_VALUE_TYPE_VARCHAR:
+            return decode_text_interned;
+        default:
+            return NULL;
+    }
+}
+
+// Decoder for Result#binary_ids, or NULL when the type has no binary form
+ValueDecoderFn value_binary_decoder_for(CassValueType type) {
+    switch (type) {
+        case CASS_VALUE_TYPE_UUID:
+        case CASS_VALUE_TYPE_TIMEUUID:
+            return decode_uuid_binary;
+        case CASS_VALUE_TYPE_INET:
+            return decode_inet_binary;
+        default:
+            return NULL;
+    }
+}
+
+// CQL name of a value type as a Symbol, e.g. :int or :list
+VALUE cass_value_type_symbol(CassValueType type) {
+    const char* name;
+    switch (type) {
+        case CASS_VALUE_TYPE_ASCII: name = "ascii"; break;
+        case CASS_VALUE_TYPE_TEXT: name = "text"; break;
+        case CASS_VALUE_TYPE_VARCHAR: name = "varchar"; break;
+        case CASS_VALUE_TYPE_TINY_INT: name = "tinyint"; break;
+        case CASS_VALUE_TYPE_SMALL_INT: name = "smallint"; break;
+        case CASS_VALUE_TYPE_INT: name = "int"; break;
+        case CASS_VALUE_TYPE_BIGINT: name = "bigint"; break;
+        case CASS_VALUE_TYPE_COUNTER: name = "counter"; break;
+        case CASS_VALUE_TYPE_VARINT: name = "varint"; break;
+        case CASS_VALUE_TYPE_BOOLEAN: name = "boolean"; break;
+        case CASS_VALUE_TYPE_DOUBLE: name = "double"; break;
+        case CASS_VALUE_TYPE_FLOAT: name = "float"; break;
+        case CASS_VALUE_TYPE_DECIMAL: name = "decimal"; break;
+        case CASS_VALUE_TYPE_UUID: name = "uuid"; break;
+        case CASS_VALUE_TYPE_TIMEUUID: name = "timeuuid"; break;
+        case CASS_VALUE_TYPE_BLOB: name = "blob"; break;
+        case CASS_VALUE_TYPE_INET: name = "inet"; break;
+        case CASS_VALUE_TYPE_LIST: name = "list"; break;
+        case CASS_VALUE_TYPE_SET: name = "set"; break;
+        case CASS_VALUE_TYPE_MAP: name = "map"; break;
+        case CASS_VALUE_TYPE_TUPLE: name = "tuple"; break;
+        case CASS_VALUE_TYPE_UDT: name = "udt"; break;
+        case CASS_VALUE_TYPE_DATE: name = "date"; break;
+        case CASS_VALUE_TYPE_TIME: name = "time"; break;
+        case CASS_VALUE_TYPE_TIMESTAMP: name = "timestamp"; break;
+        case CASS_VALUE_TYPE_DURATION: name = "duration"; break;
+        default: name = "unknown"; break;
+    }
+    return ID2SYM(rb_intern(name));
+}
+
+// Helper function to convert a CassValue to a Ruby object
+VALUE cass_value_to_ruby(const CassValue* value) {
+    if (value == NULL || cass_value_is_null(value)) {
+        return Qnil;
+    }
+    return value_decoder_for(cass_value_type(value))(value);
+}
+
+// Resolve the classes and IDs used by the decoders
+void Init_cassandra_c_value(VALUE module) {
+    rb_require("date");
+    rb_require("set");
+    rb_require("bigdecimal");
+    cDate = rb_const_get(rb_cObject, rb_intern("Date"));
+    cSet = rb_const_get(rb_cObject, rb_intern("Set"));
+    cBigDecimal = rb_const_get(rb_cObject, rb_intern("BigDecimal"));
+    rb_gc_register_address(&cDate);
+    rb_gc_register_address(&cSet);
+    rb_gc_register_address(&cBigDecimal);
+    rb_gc_register_address(&cTypesTime);
+
+    id_new = rb_intern("new");
+    id_jd = rb_intern("jd");
+    id_iv_nanoseconds = rb_intern("@nanoseconds");
+    id_BigDecimal = rb_intern("BigDecimal");
+    id_split = rb_intern("split");
+
+    static const char hex_digits[] = "0123456789abcdef";
+    for (int i = 0; i < 256; i++) {
+        hex_pairs[i * 2] = hex_digits[i >> 4];
+        hex_pairs[i * 2 + 1] = hex_digits[i & 0xF];
+    }
+    rb_define_module_function(module, "format_uuid", rb_native_format_uuid, 1);
 }
 
 // Type-specific binding functions for text/varchar (UTF-8 strings)
@@ -585,7 +850,22 @@ static CassError ruby_value_to_cass_inet_value(VALUE rb_value, CassInet* inet) {
     }
     
     // Parse the IP address string into CassInet
-    return cass_inet_from_string(ip_str, inet);
+    CassError error = cass_inet_from_string(ip_str, inet);
+
+    // Otherwise accept the 4- or 16-byte form Result#binary_ids returns, which
+    // is always ASCII-8BIT; text that fails to parse stays an error
+    if (error != CASS_OK && TYPE(rb_value) == T_STRING && rb_enc_get_index(rb_value) == rb_ascii8bit_encindex()) {
+        const cass_uint8_t* address = (const cass_uint8_t*)RSTRING_PTR(rb_value);
+        if (RSTRING_LEN(rb_value) == 4) {
+            *inet = cass_inet_init_v4(address);
+            return CASS_OK;
+        }
+        if (RSTRING_LEN(rb_value) == 16) {
+            *inet = cass_inet_init_v6(address);
+            return CASS_OK;
+        }
+    }
+    return error;
 }
 
 // Type-specific binding functions for inet (IP addresses)
@@ -687,194 +967,103 @@ CassError ruby_value_to_cass_double_by_name(CassStatement* statement, const char
     return cass_statement_bind_double_by_name(statement, name, double_val);
 }
 
-// Helper function to encode Ruby integer to varint bytes
-static void ruby_integer_to_varint_bytes(VALUE integer, cass_byte_t** varint_bytes, size_t* varint_size) {
-    // For simplicity and to avoid complex varint encoding issues, 
-    // we'll use a more direct approach that works with Ruby's integer representation
-    
-    // Check if zero
-    VALUE zero = INT2NUM(0);
-    if (rb_funcall(integer, rb_intern("=="), 1, zero) == Qtrue) {
-        *varint_bytes = (cass_byte_t*)malloc(1);
-        (*varint_bytes)[0] = 0;
-        *varint_size = 1;
-        return;
-    }
-    
-    // Get absolute value for magnitude calculation
-    VALUE abs_val = rb_funcall(integer, rb_intern("abs"), 0);
-    int is_negative = (rb_funcall(integer, rb_intern("<"), 1, zero) == Qtrue);
-    
-    // Calculate minimum number of bytes needed
-    // Using bit_length method if available, otherwise estimate
-    VALUE bit_length;
-    if (rb_respond_to(abs_val, rb_intern("bit_length"))) {
-        bit_length = rb_funcall(abs_val, rb_intern("bit_length"), 0);
-    } else {
-        // Estimate: log2(value) + 1
-        VALUE str_val = rb_funcall(abs_val, rb_intern("to_s"), 0);
-        size_t str_len = RSTRING_LEN(str_val);
-        bit_length = INT2NUM((int)(str_len * 4)); // Conservative estimate
-    }
-    
-    size_t byte_length = (NUM2INT(bit_length) + 7) / 8;
-    if (byte_length == 0) byte_length = 1;
-    
-    // For negative numbers, we may need an extra byte for sign extension
-    if (is_negative) byte_length++;
-    
-    unsigned char* bytes = (unsigned char*)malloc(byte_length);
-    memset(bytes, 0, byte_length);
-    
-    // Extract bytes using Ruby's bit shift operations
-    VALUE temp = abs_val;
-    size_t actual_bytes = 0;
-    
-    for (size_t i = 0; i < byte_length && rb_funcall(temp, rb_intern(">"), 1, zero) == Qtrue; i++) {
-        VALUE byte_val = rb_funcall(temp, rb_intern("&"), 1, INT2NUM(0xFF));
-        bytes[byte_length - 1 - i] = NUM2INT(byte_val);
-        temp = rb_funcall(temp, rb_intern(">>"), 1, INT2NUM(8));
-        actual_bytes = i + 1;
-    }
-    
-    if (actual_bytes == 0) {
-        actual_bytes = 1;
-    }
-    
-    // Adjust buffer size to actual bytes needed
-    if (actual_bytes < byte_length) {
-        memmove(bytes, bytes + byte_length - actual_bytes, actual_bytes);
-        bytes = (unsigned char*)realloc(bytes, actual_bytes);
-        byte_length = actual_bytes;
+// Encode a Ruby Integer as a CQL varint: minimal big-endian two's complement,
+// returned as a binary String so the buffer is owned by the GC
+static VALUE ruby_integer_to_varint(VALUE integer) {
+    int nlz_bits;
+    size_t size = rb_absint_size(integer, &nlz_bits) + 1;    // +1 leaves room for the sign bit
+    VALUE buffer = rb_str_new(NULL, (long)size);
+    unsigned char* bytes = (unsigned char*)RSTRING_PTR(buffer);
+
+    rb_integer_pack(integer, bytes, size, 1, 0, INTEGER_PACK_BIG_ENDIAN | INTEGER_PACK_2COMP);
+
+    // Drop leading sign-extension bytes the value does not need
+    size_t start = 0;
+    while (start + 1 < size &&
+           ((bytes[start] == 0x00 && (bytes[start + 1] & 0x80) == 0) ||
+            (bytes[start] == 0xFF && (bytes[start + 1] & 0x80) != 0))) {
+        start++;
     }
-    
-    // Apply two's complement for negative numbers
-    if (is_negative) {
-        // Invert all bits
-        for (size_t i = 0; i < byte_length; i++) {
-            bytes[i] = ~bytes[i];
-        }
-        
-        // Add 1
-        int carry = 1;
-        for (int i = (int)byte_length - 1; i >= 0 && carry; i--) {
-            int sum = bytes[i] + carry;
-            bytes[i] = sum & 0xFF;
-            carry = sum >> 8;
-        }
-        
-        // Ensure sign extension for negative numbers
-        if (carry || (bytes[0] & 0x80) == 0) {
-            bytes = (unsigned char*)realloc(bytes, byte_length + 1);
-            memmove(bytes + 1, bytes, byte_length);
-            bytes[0] = 0xFF;
-            byte_length++;
-        }
+    if (start > 0) {
+        memmove(bytes, bytes + start, size - start);
+        rb_str_set_len(buffer, (long)(size - start));
     }
-    
-    *varint_bytes = (cass_byte_t*)bytes;
-    *varint_size = byte_length;
+    return buffer;
 }
 
-
-// Helper function to convert varint bytes to Ruby integer
+// Decode a CQL varint (big-endian two's complement) into a Ruby Integer
 static VALUE ruby_varint_bytes_to_integer(const cass_byte_t* varint, size_t varint_size) {
     if (varint_size == 0) {
-        return INT2NUM(0);
-    }
-    
-    // Check if the number is negative (MSB of first byte is set)
-    int is_negative = (varint[0] & 0x80) != 0;
-    
-    // Build the number from bytes (big-endian)
-    VALUE result = INT2NUM(0);
-    VALUE byte_multiplier = INT2NUM(1);
-    
-    // Process bytes from right to left (least significant first for our calculation)
-    for (int i = (int)varint_size - 1; i >= 0; i--) {
-        unsigned char byte_val = varint[i];
-        
-        // If negative, we need to handle two's complement
-        if (is_negative) {
-            // For two's complement, we first invert all bits, then add 1
-            // We'll do this at the end for the complete number
-        }
-        
-        VALUE byte_contribution = rb_funcall(INT2NUM(byte_val), rb_intern("*"), 1, byte_multiplier);
-        result = rb_funcall(result, rb_intern("+"), 1, byte_contribution);
-        byte_multiplier = rb_funcall(byte_multiplier, rb_intern("*"), 1, INT2NUM(256));
-    }
-    
-    // Handle two's complement for negative numbers
-    if (is_negative) {
-        // Calculate 2^(bits) - result for two's complement
-        VALUE max_val = rb_funcall(INT2NUM(2), rb_intern("**"), 1, INT2NUM((int)(varint_size * 8)));
-        result = rb_funcall(result, rb_intern("-"), 1, max_val);
+        return INT2FIX(0);
     }
-    
-    return result;
+    return rb_integer_unpack(varint, varint_size, 1, 0, INTEGER_PACK_BIG_ENDIAN | INTEGER_PACK_2COMP);
 }
 
-// Helper function to convert varint bytes to Ruby Decimal
+// Build a BigDecimal from a varint and scale with a single BigDecimal() call
+// on "<unscaled>e<-scale>", which is exact
 static VALUE ruby_decimal_from_varint(const cass_byte_t* varint, size_t varint_size, cass_int32_t scale) {
-    // Convert varint bytes to Ruby integer
     VALUE unscaled = ruby_varint_bytes_to_integer(varint, varint_size);
-    
-    // Create BigDecimal from unscaled value and scale  
-    VALUE decimal_str = rb_funcall(unscaled, rb_intern("to_s"), 0);
-    VALUE big_decimal = rb_funcall(rb_mKernel, rb_intern("BigDecimal"), 1, decimal_str);
-    
-    // Apply the scale (divide by 10^scale)
-    if (scale > 0) {
-        VALUE divisor = rb_funcall(INT2NUM(10), rb_intern("**"), 1, INT2NUM(scale));
-        big_decimal = rb_funcall(big_decimal, rb_intern("/"), 1, divisor);
+    VALUE literal = FIXNUM_P(unscaled) ? rb_fix2str(unscaled, 10) : rb_big2str(unscaled, 10);
+    if (scale != 0) {
+        rb_str_catf(literal, "e%ld", -(long)scale);
     }
-    
-    // Return BigDecimal directly
-    return big_decimal;
+    return rb_funcall(rb_mKernel, id_BigDecimal, 1, literal);
 }
 
-// Type-specific binding functions for decimal (arbitrary precision)
-CassError ruby_value_to_cass_decimal(CassStatement* statement, size_t index, VALUE rb_value) {
-    if (NIL_P(rb_value)) {
-        return cass_statement_bind_null(statement, index);
+// Split a decimal value into its varint-encoded unscaled value and scale.
+// BigDecimal#split gives the significant digits and exponent directly, so no
+// decimal string formatting or powers of ten are needed.
+static CassError ruby_value_to_decimal_parts(VALUE rb_value, VALUE* varint, cass_int32_t* scale) {
+    if (RB_INTEGER_TYPE_P(rb_value)) {
+        *varint = ruby_integer_to_varint(rb_value);
+        *scale = 0;
+        return CASS_OK;
+    }
+    if (!rb_obj_is_kind_of(rb_value, cBigDecimal)) {
+        rb_value = rb_funcall(rb_mKernel, id_BigDecimal, 1, rb_obj_as_string(rb_value));
     }
 
-    cass_int32_t scale = 0;
+    // [sign, "digits", 10, exponent] meaning sign * 0.digits * 10**exponent
+    VALUE parts = rb_funcall(rb_value, id_split, 0);
+    int sign = NUM2INT(rb_ary_entry(parts, 0));
+    VALUE digits = rb_ary_entry(parts, 1);
+    long exponent = NUM2LONG(rb_ary_entry(parts, 3));
+    if (sign == 0 || RSTRING_LEN(digits) == 0 || !ISDIGIT(RSTRING_PTR(digits)[0])) {
+        return CASS_ERROR_LIB_INVALID_VALUE_TYPE;    // NaN or Infinity
+    }
 
-    // Handle BigDecimal objects directly
-    VALUE rb_cBigDecimal = rb_const_get(rb_cObject, rb_intern("BigDecimal"));
-    if (rb_obj_is_kind_of(rb_value, rb_cBigDecimal)) {
-        // Convert BigDecimal to string, then parse for scale
-        VALUE decimal_str = rb_funcall(rb_value, rb_intern("to_s"), 1, rb_str_new_cstr("F"));
-        const char* str = RSTRING_PTR(decimal_str);
-        
-        // Find the decimal point to determine scale
-        const char* decimal_point = strchr(str, '.');
-        if (decimal_point != NULL) {
-            scale = (cass_int32_t)strlen(decimal_point + 1);
-        }
-        
-        // Convert to unscaled integer
-        VALUE multiplier = rb_funcall(INT2NUM(10), rb_intern("**"), 1, INT2NUM(scale));
-        VALUE unscaled = rb_funcall(rb_value, rb_intern("*"), 1, multiplier);
-        unscaled = rb_funcall(unscaled, rb_intern("to_i"), 0);
-        
-        cass_byte_t* varint_bytes;
-        size_t varint_size;
-        ruby_integer_to_varint_bytes(unscaled, &varint_bytes, &varint_size);
+    long decimal_scale = RSTRING_LEN(digits) - exponent;
+    if (decimal_scale > INT32_MAX) {
+        return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+    }
 
-        CassError error = cass_statement_bind_decimal(statement, index, varint_bytes, varint_size, scale);
+    VALUE unscaled_digits = rb_str_new(sign < 0 ? "-" : "", sign < 0 ? 1 : 0);
+    rb_str_append(unscaled_digits, digits);
+    // Keep integral values at scale 0 as before, e.g. 1000 rather than 1E+3
+    for (; decimal_scale < 0; decimal_scale++) {
+        rb_str_cat(unscaled_digits, "0", 1);
+    }
 
-        // Free the allocated varint bytes
-        free(varint_bytes);
+    *varint = ruby_integer_to_varint(rb_str_to_inum(unscaled_digits, 10, 0));
+    *scale = (cass_int32_t)decimal_scale;
+    return CASS_OK;
+}
 
+// Type-specific binding functions for decimal (arbitrary precision)
+CassError ruby_value_to_cass_decimal(CassStatement* statement, size_t index, VALUE rb_value) {
+    if (NIL_P(rb_value)) {
+        return cass_statement_bind_null(statement, index);
+    }
+
+    VALUE varint;
+    cass_int32_t scale;
+    CassError error = ruby_value_to_decimal_parts(rb_value, &varint, &scale);
+    if (error != CASS_OK) {
         return error;
-    } else {
-        // Try to convert to BigDecimal first
-        VALUE big_decimal = rb_funcall(rb_mKernel, rb_intern("BigDecimal"), 1, rb_obj_as_string(rb_value));
-        return ruby_value_to_cass_decimal(statement, index, big_decimal);
     }
+    error = cass_statement_bind_decimal(statement, index, (const cass_byte_t*)RSTRING_PTR(varint), RSTRING_LEN(varint), scale);
+    RB_GC_GUARD(varint);
+    return error;
 }
 
 CassError ruby_value_to_cass_decimal_by_name(CassStatement* statement, const char* name, VALUE rb_value) {
@@ -882,41 +1071,24 @@ CassError ruby_value_to_cass_decimal_by_name(CassStatement* statement, const cha
         return cass_statement_bind_null_by_name(statement, name);
     }
 
-    cass_int32_t scale = 0;
-
-    // Handle BigDecimal objects directly
-    VALUE rb_cBigDecimal = rb_const_get(rb_cObject, rb_intern("BigDecimal"));
-    if (rb_obj_is_kind_of(rb_value, rb_cBigDecimal)) {
-        // Convert BigDecimal to string, then parse for scale
-        VALUE decimal_str = rb_funcall(rb_value, rb_intern("to_s"), 1, rb_str_new_cstr("F"));
-        const char* str = RSTRING_PTR(decimal_str);
-        
-        // Find the decimal point to determine scale
-        const char* decimal_point = strchr(str, '.');
-        if (decimal_point != NULL) {
-            scale = (cass_int32_t)strlen(decimal_point + 1);
-        }
-        
-        // Convert to unscaled integer
-        VALUE multiplier = rb_funcall(INT2NUM(10), rb_intern("**"), 1, INT2NUM(scale));
-        VALUE unscaled = rb_funcall(rb_value, rb_intern("*"), 1, multiplier);
-        unscaled = rb_funcall(unscaled, rb_intern("to_i"), 0);
-        
-        cass_byte_t* varint_bytes;
-        size_t varint_size;
-        ruby_integer_to_varint_bytes(unscaled, &varint_bytes, &varint_size);
-
-        CassError error = cass_statement_bind_decimal_by_name(statement, name, varint_bytes, varint_size, scale);
-
-        // Free the allocated varint bytes
-        free(varint_bytes);
-
+    VALUE varint;
+    cass_int32_t scale;
+    CassError error = ruby_value_to_decimal_parts(rb_value, &varint, &scale);
+    if (error != CASS_OK) {
         return error;
-    } else {
-        // Try to convert to BigDecimal first
-        VALUE big_decimal = rb_funcall(rb_mKernel, rb_intern("BigDecimal"), 1, rb_obj_as_string(rb_value));
-        return ruby_value_to_cass_decimal_by_name(statement, name, big_decimal);
     }
+    error = cass_statement_bind_decimal_by_name(statement, name, (const cass_byte_t*)RSTRING_PTR(varint), RSTRING_LEN(varint), scale);
+    RB_GC_GUARD(varint);
+    return error;
+}
+
+// Parse a UUID String: canonical text, or the 16 bytes Result#binary_ids returns
+static CassError ruby_string_to_cass_uuid(VALUE rb_value, CassUuid* uuid) {
+    if (RSTRING_LEN(rb_value) == 16 && rb_enc_get_index(rb_value) == rb_ascii8bit_encindex()) {
+        *uuid = uuid_from_bytes((const unsigned char*)RSTRING_PTR(rb_value));
+        return CASS_OK;
+    }
+    return cass_uuid_from_string(RSTRING_PTR(rb_value), uuid);
 }
 
 // Type-specific binding functions for UUID
@@ -930,9 +1102,8 @@ CassError ruby_value_to_cass_uuid(CassStatement* statement, size_t index, VALUE
         return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
     }
 
-    const char* uuid_cstr = RSTRING_PTR(rb_value);
     CassUuid uuid;
-    CassError error = cass_uuid_from_string(uuid_cstr, &uuid);
+    CassError error = ruby_string_to_cass_uuid(rb_value, &uuid);
     if (error != CASS_OK) {
         return error;
     }
@@ -950,9 +1121,8 @@ CassError ruby_value_to_cass_uuid_by_name(CassStatement* statement, const char*
         return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
     }
 
-    const char* uuid_cstr = RSTRING_PTR(rb_value);
     CassUuid uuid;
-    CassError error = cass_uuid_from_string(uuid_cstr, &uuid);
+    CassError error = ruby_string_to_cass_uuid(rb_value, &uuid);
     if (error != CASS_OK) {
         return error;
     }
@@ -974,9 +1144,8 @@ CassError ruby_value_to_cass_timeuuid(CassStatement* statement, size_t index, VA
 
     // Handle string TimeUUIDs for backward compatibility
     if (TYPE(rb_value) == T_STRING) {
-        const char* timeuuid_cstr = RSTRING_PTR(rb_value);
         CassUuid timeuuid;
-        CassError error = cass_uuid_from_string(timeuuid_cstr, &timeuuid);
+        CassError error = ruby_string_to_cass_uuid(rb_value, &timeuuid);
         if (error != CASS_OK) {
             return error;
         }
@@ -999,9 +1168,8 @@ CassError ruby_value_to_cass_timeuuid_by_name(CassStatement* statement, const ch
 
     // Handle string TimeUUIDs for backward compatibility
     if (TYPE(rb_value) == T_STRING) {
-        const char* timeuuid_str = StringValueCStr(rb_value);
         CassUuid timeuuid;
-        CassError error = cass_uuid_from_string(timeuuid_str, &timeuuid);
+        CassError error = ruby_string_to_cass_uuid(rb_value, &timeuuid);
         if (error != CASS_OK) {
             return error;
         }
@@ -1474,11 +1642,10 @@ static CassError bind_element_to_collection_with_type(CassCollection* collection
             return cass_collection_append_int64(collection, val);
         }
         case CASS_VALUE_TYPE_VARINT: {
-            // Convert to string representation for varint
-            VALUE str_val = rb_obj_as_string(element);
-            const char* str = RSTRING_PTR(str_val);
-            size_t len = RSTRING_LEN(str_val);
-            return cass_collection_append_string_n(collection, str, len);
+            VALUE varint = ruby_integer_to_varint(rb_Integer(element));
+            CassError error = cass_collection_append_bytes(collection, (const cass_byte_t*)RSTRING_PTR(varint), RSTRING_LEN(varint));
+            RB_GC_GUARD(varint);
+            return error;
         }
         case CASS_VALUE_TYPE_FLOAT: {
             cass_float_t val = (cass_float_t)NUM2DBL(element);
@@ -1801,11 +1968,10 @@ static CassError bind_value_with_type_hint(CassStatement* statement, size_t inde
             return cass_statement_bind_int64(statement, index, val);
         }
         case CASS_VALUE_TYPE_VARINT: {
-            // Convert to string representation for varint
-            VALUE str_val = rb_obj_as_string(rb_value);
-            const char* str = RSTRING_PTR(str_val);
-            size_t len = RSTRING_LEN(str_val);
-            return cass_statement_bind_string_n(statement, index, str, len);
+            VALUE varint = ruby_integer_to_varint(rb_Integer(rb_value));
+            CassError error = cass_statement_bind_bytes(statement, index, (const cass_byte_t*)RSTRING_PTR(varint), RSTRING_LEN(varint));
+            RB_GC_GUARD(varint);
+            return error;
         }
         case CASS_VALUE_TYPE_FLOAT: {
             cass_float_t val = (cass_float_t)NUM2DBL(rb_value);
@@ -1883,11 +2049,10 @@ static CassError bind_value_with_type_hint_by_name(CassStatement* statement, con
             return cass_statement_bind_int64_by_name(statement, name, val);
         }
         case CASS_VALUE_TYPE_VARINT: {
-            // Convert to string representation for varint
-            VALUE str_val = rb_obj_as_string(rb_value);
-            const char* str = RSTRING_PTR(str_val);
-            size_t len = RSTRING_LEN(str_val);
-            return cass_statement_bind_string_by_name_n(statement, name, strlen(name), str, len);
+            VALUE varint = ruby_integer_to_varint(rb_Integer(rb_value));
+            CassError error = cass_statement_bind_bytes_by_name(statement, name, (const cass_byte_t*)RSTRING_PTR(varint), RSTRING_LEN(varint));
+            RB_GC_GUARD(varint);
+            return error;
         }
         case CASS_VALUE_TYPE_FLOAT: {
             cass_float_t val = (cass_float_t)NUM2DBL(rb_value);
@@ -2001,6 +2166,45 @@ CassError ruby_value_to_cass_statement_with_type_by_name(CassStatement* statemen
 // Date/Time Binding Functions  
 // ============================================================================
 
+// Convert a Ruby Date (or raw day count) to days since Unix epoch
+static CassError ruby_value_to_date_days(VALUE rb_value, cass_uint32_t* date_days) {
+    if (rb_obj_is_kind_of(rb_value, cDate)) {
+        long long julian_day = NUM2LL(rb_funcall(rb_value, id_jd, 0));
+        *date_days = (cass_uint32_t)(julian_day - UNIX_EPOCH_JD);
+    } else if (FIXNUM_P(rb_value) || TYPE(rb_value) == T_BIGNUM) {
+        *date_days = (cass_uint32_t)NUM2UINT(rb_value);
+    } else {
+        return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+    }
+    return CASS_OK;
+}
+
+// Convert a CassandraC::Types::Time (or raw count) to nanoseconds since midnight
+static CassError ruby_value_to_time_nanos(VALUE rb_value, cass_int64_t* time_nanos) {
+    if (rb_obj_is_kind_of(rb_value, types_time_class())) {
+        *time_nanos = (cass_int64_t)NUM2LL(rb_ivar_get(rb_value, id_iv_nanoseconds));
+    } else if (FIXNUM_P(rb_value) || TYPE(rb_value) == T_BIGNUM) {
+        *time_nanos = (cass_int64_t)NUM2LL(rb_value);
+    } else {
+        return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+    }
+    return CASS_OK;
+}
+
+// Convert a Ruby Time (or raw count) to milliseconds since Unix epoch
+static CassError ruby_value_to_timestamp_millis(VALUE rb_value, cass_int64_t* timestamp_millis) {
+    if (rb_obj_is_kind_of(rb_value, rb_cTime)) {
+        // tv_nsec is never negative, so this floors pre-epoch times
+        struct timespec ts = rb_time_timespec(rb_value);
+        *timestamp_millis = (cass_int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+    } else if (FIXNUM_P(rb_value) || TYPE(rb_value) == T_BIGNUM) {
+        *timestamp_millis = (cass_int64_t)NUM2LL(rb_value);
+    } else {
+        return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+    }
+    return CASS_OK;
+}
+
 // Type-specific binding functions for date (days since Unix epoch)
 CassError ruby_value_to_cass_date(CassStatement* statement, size_t index, VALUE rb_value) {
     if (NIL_P(rb_value)) {
@@ -2008,20 +2212,10 @@ CassError ruby_value_to_cass_date(CassStatement* statement, size_t index, VALUE
     }
     
     cass_uint32_t date_days;
-    
-    // Handle Ruby Date objects directly
-    VALUE date_class = rb_const_get(rb_cObject, rb_intern("Date"));
-    if (rb_obj_is_kind_of(rb_value, date_class)) {
-        // Convert Ruby Date to days since Unix epoch
-        VALUE epoch_date = rb_funcall(date_class, rb_intern("new"), 3, INT2NUM(1970), INT2NUM(1), INT2NUM(1));
-        VALUE days_diff = rb_funcall(rb_value, rb_intern("-"), 1, epoch_date);
-        date_days = (cass_uint32_t)NUM2UINT(rb_funcall(days_diff, rb_intern("to_i"), 0));
-    } else if (FIXNUM_P(rb_value) || TYPE(rb_value) == T_BIGNUM) {
-        date_days = (cass_uint32_t)NUM2UINT(rb_value);
-    } else {
-        return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+    CassError error = ruby_value_to_date_days(rb_value, &date_days);
+    if (error != CASS_OK) {
+        return error;
     }
-    
     return cass_statement_bind_uint32(statement, index, date_days);
 }
 
@@ -2031,20 +2225,10 @@ CassError ruby_value_to_cass_date_by_name(CassStatement* statement, const char*
     }
     
     cass_uint32_t date_days;
-    
-    // Handle Ruby Date objects directly
-    VALUE date_class = rb_const_get(rb_cObject, rb_intern("Date"));
-    if (rb_obj_is_kind_of(rb_value, date_class)) {
-        // Convert Ruby Date to days since Unix epoch
-        VALUE epoch_date = rb_funcall(date_class, rb_intern("new"), 3, INT2NUM(1970), INT2NUM(1), INT2NUM(1));
-        VALUE days_diff = rb_funcall(rb_value, rb_intern("-"), 1, epoch_date);
-        date_days = (cass_uint32_t)NUM2UINT(rb_funcall(days_diff, rb_intern("to_i"), 0));
-    } else if (FIXNUM_P(rb_value) || TYPE(rb_value) == T_BIGNUM) {
-        date_days = (cass_uint32_t)NUM2UINT(rb_value);
-    } else {
-        return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+    CassError error = ruby_value_to_date_days(rb_value, &date_days);
+    if (error != CASS_OK) {
+        return error;
     }
-    
     return cass_statement_bind_uint32_by_name(statement, name, date_days);
 }
 
@@ -2055,21 +2239,10 @@ CassError ruby_value_to_cass_time(CassStatement* statement, size_t index, VALUE
     }
     
     cass_int64_t time_nanos;
-    
-    // Handle CassandraC::Types::Time objects
-    VALUE mCassandraC = rb_const_get(rb_cObject, rb_intern("CassandraC"));
-    VALUE mTypes = rb_const_get(mCassandraC, rb_intern("Types"));
-    VALUE cTime = rb_const_get(mTypes, rb_intern("Time"));
-    
-    if (rb_obj_is_kind_of(rb_value, cTime)) {
-        VALUE nanos_value = rb_funcall(rb_value, rb_intern("nanoseconds_since_midnight"), 0);
-        time_nanos = (cass_int64_t)NUM2LL(nanos_value);
-    } else if (FIXNUM_P(rb_value) || TYPE(rb_value) == T_BIGNUM) {
-        time_nanos = (cass_int64_t)NUM2LL(rb_value);
-    } else {
-        return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+    CassError error = ruby_value_to_time_nanos(rb_value, &time_nanos);
+    if (error != CASS_OK) {
+        return error;
     }
-    
     return cass_statement_bind_int64(statement, index, time_nanos);
 }
 
@@ -2079,21 +2252,10 @@ CassError ruby_value_to_cass_time_by_name(CassStatement* statement, const char*
     }
     
     cass_int64_t time_nanos;
-    
-    // Handle CassandraC::Types::Time objects
-    VALUE mCassandraC = rb_const_get(rb_cObject, rb_intern("CassandraC"));
-    VALUE mTypes = rb_const_get(mCassandraC, rb_intern("Types"));
-    VALUE cTime = rb_const_get(mTypes, rb_intern("Time"));
-    
-    if (rb_obj_is_kind_of(rb_value, cTime)) {
-        VALUE nanos_value = rb_funcall(rb_value, rb_intern("nanoseconds_since_midnight"), 0);
-        time_nanos = (cass_int64_t)NUM2LL(nanos_value);
-    } else if (FIXNUM_P(rb_value) || TYPE(rb_value) == T_BIGNUM) {
-        time_nanos = (cass_int64_t)NUM2LL(rb_value);
-    } else {
-        return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+    CassError error = ruby_value_to_time_nanos(rb_value, &time_nanos);
+    if (error != CASS_OK) {
+        return error;
     }
-    
     return cass_statement_bind_int64_by_name(statement, name, time_nanos);
 }
 
@@ -2104,20 +2266,10 @@ CassError ruby_value_to_cass_timestamp(CassStatement* statement, size_t index, V
     }
     
     cass_int64_t timestamp_millis;
-    
-    // Handle Ruby Time objects directly
-    VALUE time_class = rb_const_get(rb_cObject, rb_intern("Time"));
-    if (rb_obj_is_kind_of(rb_value, time_class)) {
-        // Convert Ruby Time to milliseconds since Unix epoch
-        VALUE time_float = rb_funcall(rb_value, rb_intern("to_f"), 0);
-        double time_seconds = NUM2DBL(time_float);
-        timestamp_millis = (cass_int64_t)(time_seconds * 1000.0);
-    } else if (FIXNUM_P(rb_value) || TYPE(rb_value) == T_BIGNUM) {
-        timestamp_millis = (cass_int64_t)NUM2LL(rb_value);
-    } else {
-        return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+    CassError error = ruby_value_to_timestamp_millis(rb_value, &timestamp_millis);
+    if (error != CASS_OK) {
+        return error;
     }
-    
     return cass_statement_bind_int64(statement, index, timestamp_millis);
 }
 
@@ -2127,19 +2279,9 @@ CassError ruby_value_to_cass_timestamp_by_name(CassStatement* statement, const c
     }
     
     cass_int64_t timestamp_millis;
-    
-    // Handle Ruby Time objects directly
-    VALUE time_class = rb_const_get(rb_cObject, rb_intern("Time"));
-    if (rb_obj_is_kind_of(rb_value, time_class)) {
-        // Convert Ruby Time to milliseconds since Unix epoch
-        VALUE time_float = rb_funcall(rb_value, rb_intern("to_f"), 0);
-        double time_seconds = NUM2DBL(time_float);
-        timestamp_millis = (cass_int64_t)(time_seconds * 1000.0);
-    } else if (FIXNUM_P(rb_value) || TYPE(rb_value) == T_BIGNUM) {
-        timestamp_millis = (cass_int64_t)NUM2LL(rb_value);
-    } else {
-        return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+    CassError error = ruby_value_to_timestamp_millis(rb_value, &timestamp_millis);
+    if (error != CASS_OK) {
+        return error;
     }
-    
     return cass_statement_bind_int64_by_name(statement, name, timestamp_millis);
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 require_relative "cassandra_c/version"
 require_relative "cassandra_c/cassandra_c"
 require_relative "cassandra_c/types"
+require_relative "cassandra_c/scan"
 
 module CassandraC
   # Native module contains the low-level C++ driver bindings
@@ -52,6 +53,30 @@ module CassandraC
       end
     end
 
+    class Result
+      # Paging state as a compact URL-safe string (unpadded base64url), or nil
+      # on the last page
+      # @return [String, nil]
+      def paging_token
+        state = paging_state
+        state && [state].pack("m0").tr("+/", "-_").delete("=")
+      end
+    end
+
+    class Statement
+      # Resume from a token returned by Result#paging_token
+      # @param token [String, nil] URL-safe token; nil starts from the first page
+      def paging_token=(token)
+        self.paging_state = token && begin
+          encoded = token.tr("-_", "+/")
+          encoded += "=" * (-encoded.length % 4)
+          encoded.unpack1("m0")
+        end
+      rescue ArgumentError
+        raise ArgumentError, "invalid paging token"
+      end
+    end
+
     # Add convenience methods to Batch class
     class Batch
       # Add multiple statements at once
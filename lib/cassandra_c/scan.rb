@@ -0,0 +1,175 @@
+# frozen_string_literal: true
+
+module CassandraC
+  module Native
+    class Session
+      # Scan a whole table in parallel by splitting the Murmur3 token ring into
+      # ranges and paging through each range with its own query
+      # @param keyspace [String] Keyspace name
+      # @param table [String] Table name
+      # @param columns [Array<String>, nil] Columns to select (all when nil)
+      # @param splits [Integer] Number of token ranges
+      # @param concurrency [Integer] Maximum number of ranges queried at once
+      # @param page_size [Integer, nil] Rows per page
+      # @param pages [Boolean] Yield each page as a Result instead of each row
+      # @param checkpoint [String, nil] File recording completed ranges; a scan
+      #   with the same file and splits skips ranges already completed
+      # @yield [row] Each row (or page), on the calling thread
+      # @return [self, Enumerator]
+      def scan(keyspace, table, columns: nil, splits: 256, concurrency: 16, page_size: nil, pages: false, checkpoint: nil, &block)
+        unless block
+          return enum_for(:scan, keyspace, table, columns: columns, splits: splits, concurrency: concurrency,
+            page_size: page_size, pages: pages, checkpoint: checkpoint)
+        end
+
+        scan = TokenRangeScan.new(self, keyspace, table, columns: columns, splits: splits, page_size: page_size)
+        scan.run(concurrency: concurrency, pages: pages, checkpoint: checkpoint, &block)
+        self
+      end
+    end
+
+    # A full-table scan split over Murmur3 token ranges; see Session#scan
+    class TokenRangeScan
+      MIN_TOKEN = -2**63
+      MAX_TOKEN = 2**63 - 1
+
+      def initialize(session, keyspace, table, columns: nil, splits: 256, page_size: nil)
+        unless splits.is_a?(Integer) && splits > 0
+          raise ArgumentError, "splits must be a positive Integer"
+        end
+
+        @session = session
+        @splits = splits
+        @page_size = page_size
+
+        token = "token(#{partition_key(keyspace, table).join(", ")})"
+        selected = columns ? Array(columns).join(", ") : "*"
+        from = "#{quote(keyspace)}.#{quote(table)}"
+        @prepared = session.prepare("SELECT #{selected} FROM #{from} WHERE #{token} > ? AND #{token} <= ?")
+      end
+
+      # Token range `index` as [exclusive start, inclusive end]. The ranges
+      # cover every token except MIN_TOKEN, which Murmur3 never produces.
+      def range(index)
+        [boundary(index), boundary(index + 1)]
+      end
+
+      # Query up to `concurrency` ranges at once and yield their rows (or
+      # pages). The next page of a range is requested before the current page
+      # is yielded. Requests still in flight when the scan stops early are
+      # cancelled.
+      def run(concurrency: 16, pages: false, checkpoint: nil)
+        unless concurrency.is_a?(Integer) && concurrency > 0
+          raise ArgumentError, "concurrency must be a positive Integer"
+        end
+
+        pending = (0...@splits).to_a - completed_ranges(checkpoint)
+        log = open_checkpoint(checkpoint)
+        in_flight = {}
+
+        until pending.empty? && in_flight.empty?
+          while in_flight.size < concurrency && (index = pending.shift)
+            statement = range_statement(index)
+            in_flight[@session.execute(statement, async: true)] = [index, statement]
+          end
+
+          future = Future.wait_any(in_flight.keys)
+          index, statement = in_flight.delete(future)
+          page = future.get_result
+
+          state = page.paging_state
+          if state
+            statement.paging_state = state
+            in_flight[@session.execute(statement, async: true)] = [index, statement]
+          end
+
+          if pages
+            yield page
+          else
+            page.each { |row| yield row }
+          end
+
+          if log && state.nil?
+            log.puts(index)
+            log.flush
+          end
+        end
+      ensure
+        in_flight&.each_key(&:cancel)
+        log&.close
+      end
+
+      private
+
+      def boundary(index)
+        return MAX_TOKEN if index >= @splits
+        MIN_TOKEN + (2**64 * index) / @splits
+      end
+
+      def range_statement(index)
+        first, last = range(index)
+        statement = @prepared.bind
+        statement.bind_by_index(0, first, :bigint)
+        statement.bind_by_index(1, last, :bigint)
+        statement.page_size = @page_size if @page_size
+        statement
+      end
+
+      # Quoted partition key columns in key order
+      def partition_key(keyspace, table)
+        columns = @session.prepare(
+          "SELECT column_name, kind, position FROM system_schema.columns WHERE keyspace_name = ? AND table_name = ?"
+        ).bind([keyspace.to_s, table.to_s])
+
+        key = @session.execute(columns).select { |_, kind, _| kind == "partition_key" }.sort_by(&:last)
+        raise ArgumentError, "Unknown table #{keyspace}.#{table}" if key.empty?
+
+        key.map { |name, _, _| quote(name) }
+      end
+
+      # A quoted CQL identifier, matched case-sensitively like the schema lookup
+      def quote(name)
+        %("#{name.to_s.gsub('"', '""')}")
+      end
+
+      # The checkpoint is a header naming the split count followed by one
+      # completed range index per line
+      def completed_ranges(checkpoint)
+        return [] unless checkpoint && File.exist?(checkpoint)
+
+        header, *lines = checkpoint_lines(checkpoint)
+        return [] if header.nil?
+        unless header == checkpoint_header
+          raise ArgumentError, "Checkpoint #{checkpoint} was written for a different number of splits"
+        end
+
+        lines.map { |line| Integer(line) }
+      end
+
+      def open_checkpoint(checkpoint)
+        return unless checkpoint
+
+        lines = File.exist?(checkpoint) ? checkpoint_lines(checkpoint) : []
+        lines = [checkpoint_header] if lines.empty?
+
+        # Replace the file so a line cut short by an interrupted write is gone
+        partial = "#{checkpoint}.tmp"
+        File.write(partial, lines.map { |line| "#{line}\n" }.join)
+        File.rename(partial, checkpoint)
+        File.open(checkpoint, "a")
+      end
+
+      # Complete lines of the checkpoint; a last line without a newline was
+      # cut short and is dropped
+      def checkpoint_lines(checkpoint)
+        lines = File.read(checkpoint).lines
+        lines.pop if lines.last && !lines.last.end_with?("\n")
+        lines.map(&:chomp)
+      end
+
+      def checkpoint_header
+        "splits #{@splits}"
+      end
+    end
+  end
+end
@@ -0,0 +1,92 @@
+# frozen_string_literal: true
+
+require "test_helper"
+
+class TestCompletionQueue < Minitest::Test
+  QUERY = "SELECT keyspace_name FROM system_schema.keyspaces"
+
+  def poll_all(queue, count)
+    pairs = []
+    pairs.concat(queue.poll(timeout: 10)) while pairs.size < count
+    pairs
+  end
+
+  def test_execute_into_queue_returns_tagged_results
+    queue = CassandraC::Native::CompletionQueue.new
+    10.times { |i| assert_nil session.execute(QUERY, queue: queue, tag: i) }
+
+    pairs = poll_all(queue, 10)
+
+    assert_equal (0...10).to_a, pairs.map(&:first).sort
+    pairs.each { |_, result| assert_kind_of CassandraC::Native::Result, result }
+    assert_equal 0, queue.pending
+  end
+
+  def test_failures_are_returned_as_errors
+    queue = CassandraC::Native::CompletionQueue.new
+    session.execute("SELECT * FROM no_such_table", queue: queue, tag: :bad)
+
+    tag, error = poll_all(queue, 1).first
+
+    assert_equal :bad, tag
+    assert_kind_of CassandraC::Error, error
+  end
+
+  def test_prepare_and_batch_into_queue
+    queue = CassandraC::Native::CompletionQueue.new
+    session.prepare(QUERY, queue: queue, tag: :prepare)
+    batch = CassandraC::Native::Batch.new(:logged)
+    batch.add(CassandraC::Native::Statement.new("INSERT INTO cassandra_c_test.test_bind_params (keyspace_name, id) VALUES ('cq', 'cq')"))
+    session.execute_batch(batch, queue: queue, tag: :batch)
+
+    values = poll_all(queue, 2).to_h
+
+    assert_kind_of CassandraC::Native::Prepared, values[:prepare]
+    assert_kind_of CassandraC::Native::Result, values[:batch]
+  end
+
+  def test_poll_respects_max
+    queue = CassandraC::Native::CompletionQueue.new
+    5.times { |i| session.execute(QUERY, queue: queue, tag: i) }
+
+    assert_equal 1, queue.poll(max: 1, timeout: 10).size
+    assert_equal 4, queue.pending
+    poll_all(queue, 4)
+  end
+
+  def test_poll_times_out_when_empty
+    queue = CassandraC::Native::CompletionQueue.new
+    assert_equal [], queue.poll(timeout: 0.01)
+    assert_equal [], queue.poll(timeout: 0)
+  end
+
+  def test_poll_without_timeout_returns_when_nothing_is_pending
+    queue = CassandraC::Native::CompletionQueue.new
+    assert_equal [], queue.poll
+
+    session.execute(QUERY, queue: queue)
+    assert_equal 1, queue.poll.size
+    assert_equal 0, queue.pending
+    assert_equal [], queue.poll
+  end
+
+  def test_untagged_requests_report_nil_tag
+    queue = CassandraC::Native::CompletionQueue.new
+    session.execute(QUERY, queue: queue)
+
+    tag, result = poll_all(queue, 1).first
+
+    assert_nil tag
+    assert_kind_of CassandraC::Native::Result, result
+  end
+
+  def test_rejects_invalid_queue
+    assert_raises(TypeError) { session.execute(QUERY, queue: Object.new) }
+  end
+
+  def test_rejects_invalid_poll_arguments
+    queue = CassandraC::Native::CompletionQueue.new
+    assert_raises(ArgumentError) { queue.poll(max: 0) }
+    assert_raises(ArgumentError) { queue.poll(timeout: -1) }
+  end
+end
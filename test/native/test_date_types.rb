@@ -127,6 +127,20 @@ class TestDateTypes < Minitest::Test
     assert_in_delta time_val.to_f, row[0].to_f, 0.001
   end
 
+  def test_timestamp_round_trip_keeps_milliseconds
+    # Timestamps are converted without going through a Float
+    times = [Time.at(1_700_000_000, 123, :millisecond), Time.at(-1, 250, :millisecond)]
+
+    prepared = @session.prepare("INSERT INTO test_dates.date_types_table (id, timestamp_col) VALUES (?, ?)")
+    times.each_with_index { |time, i| @session.query(prepared.bind([110 + i, time])) }
+
+    times.each_with_index do |time, i|
+      row = @session.query("SELECT timestamp_col FROM test_dates.date_types_table WHERE id = #{110 + i}").first
+      assert_equal time, row[0]
+      assert_equal time.utc_offset, row[0].utc_offset
+    end
+  end
+
   def test_date_type_parameter_binding_by_name
     # Test binding Date objects by name
     date_val = Date.new(2024, 12, 31)
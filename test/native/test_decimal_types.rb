@@ -85,4 +85,32 @@ class TestDecimalTypes < Minitest::Test
     assert_instance_of BigDecimal, retrieved
     assert_equal precise_value, retrieved
   end
+
+  def test_decimal_matches_cql_literals
+    require "bigdecimal"
+
+    session.query("INSERT INTO cassandra_c_test.decimal_types (id, decimal_val) VALUES (76, -0.00123)")
+    session.query("INSERT INTO cassandra_c_test.decimal_types (id, decimal_val) VALUES (77, 1000)")
+
+    result = session.query("SELECT decimal_val FROM cassandra_c_test.decimal_types WHERE id IN (76, 77)")
+    assert_equal [BigDecimal("-0.00123"), BigDecimal("1000")], result.to_a.map(&:first).sort
+  end
+
+  def test_decimal_integral_and_negative_values
+    require "bigdecimal"
+
+    statement = CassandraC::Native::Statement.new("INSERT INTO cassandra_c_test.decimal_types (id, decimal_val) VALUES (?, ?)", 2)
+    values = [BigDecimal("1000"), BigDecimal("-0.5"), BigDecimal("0"), 42]
+
+    values.each_with_index do |value, i|
+      statement.bind_by_index(0, 78 + i, :int)
+      statement.bind_by_index(1, value, :decimal)
+      session.execute(statement)
+    end
+
+    values.each_with_index do |value, i|
+      result = session.query("SELECT decimal_val FROM cassandra_c_test.decimal_types WHERE id = #{78 + i}")
+      assert_equal BigDecimal(value.to_s), result.to_a.first[0]
+    end
+  end
 end
@@ -0,0 +1,41 @@
+# frozen_string_literal: true
+
+require "test_helper"
+
+class TestExecuteConcurrent < Minitest::Test
+  INSERT = "INSERT INTO cassandra_c_test.test_bind_params (keyspace_name, id) VALUES (?, ?)"
+
+  def test_executes_every_row
+    prepared = session.prepare(INSERT)
+    rows = Array.new(100) { |i| ["concurrent_#{i}", i.to_s] }
+
+    results = session.execute_concurrent(prepared, rows, concurrency: 8)
+
+    assert_equal 100, results.size
+    results.each { |result| assert_kind_of CassandraC::Native::Result, result }
+
+    select = session.prepare("SELECT id FROM cassandra_c_test.test_bind_params WHERE keyspace_name = ?")
+    assert_equal [["42"]], session.execute(select.bind(["concurrent_42"])).to_a
+  end
+
+  def test_reports_errors_per_row
+    prepared = session.prepare(INSERT)
+    rows = [["concurrent_ok", "1"], ["concurrent_bad"], "not an array", ["concurrent_ok2", "2"]]
+
+    results = session.execute_concurrent(prepared, rows)
+
+    assert_kind_of CassandraC::Native::Result, results[0]
+    assert_kind_of CassandraC::Error, results[1]
+    assert_kind_of ArgumentError, results[2]
+    assert_kind_of CassandraC::Native::Result, results[3]
+  end
+
+  def test_empty_rows
+    assert_equal [], session.execute_concurrent(session.prepare(INSERT), [])
+  end
+
+  def test_rejects_invalid_concurrency
+    prepared = session.prepare(INSERT)
+    assert_raises(ArgumentError) { session.execute_concurrent(prepared, [], concurrency: 0) }
+  end
+end
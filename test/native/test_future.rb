@@ -0,0 +1,314 @@
+# frozen_string_literal: true
+
+require "test_helper"
+
+class TestFuture < Minitest::Test
+  QUERY = "SELECT keyspace_name FROM system_schema.keyspaces"
+
+  def test_wait_returns_self
+    future = session.execute(QUERY, async: true)
+    assert_same future, future.wait
+    assert future.ready?
+  end
+
+  def test_wait_timed_returns_true_when_completed
+    future = session.execute(QUERY, async: true)
+    assert future.wait_timed(5_000_000)
+    assert future.ready?
+  end
+
+  def test_wait_timed_rejects_negative_timeout
+    future = session.execute(QUERY, async: true)
+    assert_raises(ArgumentError) { future.wait_timed(-1) }
+    future.wait
+  end
+
+  def test_other_threads_run_while_waiting
+    futures = Array.new(20) { session.execute(QUERY, async: true) }
+    counter = 0
+    ticker = Thread.new { loop { counter += 1 } }
+
+    futures.each(&:wait)
+    ticker.kill
+    ticker.join
+
+    assert counter > 0
+  end
+
+  def test_concurrent_synchronous_execution
+    results = Array.new(8) {
+      Thread.new { session.execute(QUERY) }
+    }.map(&:value)
+
+    results.each { |result| assert_kind_of CassandraC::Native::Result, result }
+  end
+
+  def test_waiting_thread_can_be_killed
+    thread = Thread.new {
+      loop { session.execute(QUERY) }
+    }
+    sleep 0.05
+    thread.kill
+    assert thread.join(5), "thread blocked in a driver wait should be killable"
+  end
+
+  def test_wait_parks_fiber_under_scheduler
+    skip "Fiber scheduler C API requires Ruby 3.1+" if RUBY_VERSION < "3.1"
+    test_session = session
+    scheduler = RecordingScheduler.new
+    events = []
+
+    result = Thread.new {
+      Fiber.set_scheduler(scheduler)
+      value = nil
+      Fiber.schedule {
+        future = test_session.execute(QUERY, async: true)
+        future.wait
+        events << :resumed
+        value = future.get_result
+      }
+      Fiber.schedule { events << :sibling }
+      scheduler.run
+      value
+    }.value
+
+    assert_kind_of CassandraC::Native::Result, result
+    assert_operator scheduler.io_waits, :>, 0
+    assert_equal [:sibling, :resumed], events
+  end
+
+  def test_timed_waits_under_scheduler_share_one_pipe
+    skip "Fiber scheduler C API requires Ruby 3.1+" if RUBY_VERSION < "3.1"
+    skip "Descriptor count needs /proc/self/fd" unless File.directory?("/proc/self/fd")
+    test_session = session
+
+    before, after = Thread.new {
+      Fiber.set_scheduler(RecordingScheduler.new)
+      counts = nil
+      Fiber.schedule {
+        future = test_session.execute(QUERY, async: true)
+        open_fds = Dir.children("/proc/self/fd").size
+        20.times { future.wait_timed(1) }
+        counts = [open_fds, Dir.children("/proc/self/fd").size]
+        future.wait
+      }
+      Fiber.scheduler.run
+      counts
+    }.value
+
+    assert_operator after, :<=, before + 2
+  end
+
+  def test_synchronous_execute_under_scheduler
+    skip "Fiber scheduler C API requires Ruby 3.1+" if RUBY_VERSION < "3.1"
+    test_session = session
+    scheduler = RecordingScheduler.new
+    events = []
+
+    result = Thread.new {
+      Fiber.set_scheduler(scheduler)
+      value = nil
+      Fiber.schedule {
+        value = test_session.execute(QUERY)
+        events << :resumed
+      }
+      Fiber.schedule { events << :sibling }
+      scheduler.run
+      value
+    }.value
+
+    assert_kind_of CassandraC::Native::Result, result
+    assert_operator scheduler.io_waits, :>, 0
+    assert_equal [:sibling, :resumed], events
+  end
+
+  def test_on_complete_receives_result
+    queue = Queue.new
+    future = session.execute(QUERY, async: true)
+    assert_same future, future.on_complete { |value| queue << value }
+
+    assert_kind_of CassandraC::Native::Result, queue.pop
+  end
+
+  def test_on_complete_after_completion
+    queue = Queue.new
+    future = session.execute(QUERY, async: true).wait
+    future.on_complete { |value| queue << value }
+
+    assert_kind_of CassandraC::Native::Result, queue.pop
+  end
+
+  def test_on_failure_receives_error
+    queue = Queue.new
+    future = session.execute("SELECT * FROM no_such_table", async: true)
+    future.on_success { |value| queue << [:success, value] }
+    future.on_failure { |error| queue << [:failure, error] }
+
+    kind, error = queue.pop
+    assert_equal :failure, kind
+    assert_kind_of CassandraC::Error, error
+    assert_match(/Future error/, error.message)
+  end
+
+  def test_on_success_receives_prepared
+    queue = Queue.new
+    future = session.prepare(QUERY, async: true)
+    future.on_success { |prepared| queue << prepared }
+
+    assert_kind_of CassandraC::Native::Prepared, queue.pop
+  end
+
+  def test_callbacks_run_in_registration_order
+    queue = Queue.new
+    future = session.execute(QUERY, async: true)
+    future.on_complete { queue << 1 }
+    future.on_complete { queue << 2 }
+
+    assert_equal [1, 2], [queue.pop, queue.pop]
+  end
+
+  def test_raising_callback_does_not_stop_dispatch
+    queue = Queue.new
+    _, stderr = capture_io {
+      session.execute(QUERY, async: true).on_complete { raise "boom" }
+      session.execute(QUERY, async: true).on_complete { |value| queue << value }
+      queue.pop
+    }
+
+    assert_match(/boom/, stderr)
+  end
+
+  def test_killed_dispatcher_keeps_pending_callbacks
+    queue = Queue.new
+    futures = Array.new(5) { session.execute(QUERY, async: true).wait }
+    futures.first.on_complete { Thread.current.kill }
+    futures.drop(1).each { |future| future.on_complete { |value| queue << value } }
+    sleep 0.01 while Thread.list.any? { |thread| thread.name == "cassandra_c-dispatch" }
+
+    # The next registration starts a new dispatcher, which runs the rest
+    session.execute(QUERY, async: true).on_complete { |value| queue << value }
+    5.times { assert_kind_of CassandraC::Native::Result, queue.pop }
+  end
+
+  def test_on_complete_requires_block
+    future = session.execute(QUERY, async: true)
+    assert_raises(LocalJumpError) { future.on_complete }
+    future.wait
+  end
+
+  def test_wait_all_returns_values_in_order
+    futures = Array.new(5) { session.execute(QUERY, async: true) }
+    futures << session.execute("SELECT * FROM no_such_table", async: true)
+
+    values = CassandraC::Native::Future.wait_all(futures, timeout: 10)
+
+    assert_equal 6, values.size
+    values.first(5).each { |value| assert_kind_of CassandraC::Native::Result, value }
+    assert_kind_of CassandraC::Error, values.last
+    assert futures.all?(&:ready?)
+  end
+
+  def test_wait_all_with_no_futures
+    assert_equal [], CassandraC::Native::Future.wait_all([])
+  end
+
+  def test_wait_any_returns_a_completed_future
+    futures = Array.new(5) { session.execute(QUERY, async: true) }
+
+    future = CassandraC::Native::Future.wait_any(futures, timeout: 10)
+
+    assert_includes futures, future
+    assert future.ready?
+    futures.each(&:wait)
+  end
+
+  def test_wait_any_with_no_futures
+    assert_nil CassandraC::Native::Future.wait_any([])
+  end
+
+  def test_prepare_bind_execute_pipeline
+    select = "SELECT keyspace_name FROM system_schema.keyspaces WHERE keyspace_name = ?"
+
+    future = session.prepare(select, async: true).then_bind(["system"]).then_execute(session)
+
+    result = future.wait.get_result
+    assert_kind_of CassandraC::Native::Result, result
+    assert_equal [["system"]], result.to_a
+    assert future.ready?
+  end
+
+  def test_then_execute_binds_prepared_without_params
+    future = session.prepare(QUERY, async: true).then_execute(session)
+    assert_kind_of CassandraC::Native::Result, future.get_result
+  end
+
+  def test_then_transforms_value
+    future = session.execute(QUERY, async: true).then { |result| result.to_a.size }
+    assert_operator future.wait.get_result, :>, 0
+    assert_equal CassandraC::Native::Future, future.class
+  end
+
+  def test_chained_future_runs_callbacks
+    queue = Queue.new
+    session.prepare(QUERY, async: true).then_bind.then_execute(session).on_success { |value| queue << value }
+
+    assert_kind_of CassandraC::Native::Result, queue.pop
+  end
+
+  def test_chain_propagates_upstream_failure
+    future = session.prepare("SELECT * FROM no_such_table", async: true).then_bind([1]).then_execute(session)
+
+    assert future.wait_timed(10_000_000)
+    assert_nil future.error_code
+    assert_raises(CassandraC::Error) { future.get_result }
+  end
+
+  def test_chain_captures_block_errors
+    future = session.execute(QUERY, async: true).then { raise ArgumentError, "bad value" }
+
+    error = assert_raises(ArgumentError) { future.get_result }
+    assert_equal "bad value", error.message
+    assert_equal "bad value", future.error_message
+  end
+
+  def test_chained_futures_in_wait_all
+    futures = Array.new(3) { session.prepare(QUERY, async: true).then_execute(session) }
+
+    values = CassandraC::Native::Future.wait_all(futures, timeout: 10)
+
+    values.each { |value| assert_kind_of CassandraC::Native::Result, value }
+  end
+
+  def test_then_bind_rejects_non_array
+    future = session.prepare(QUERY, async: true)
+    assert_raises(TypeError) { future.then_bind("system") }
+    assert_raises(TypeError) { future.then_execute(Object.new) }
+    future.wait
+  end
+
+  def test_cancel_abandons_future
+    future = session.execute(QUERY, async: true)
+
+    assert_includes [true, false], future.cancel
+    assert future.cancelled?
+    assert_equal false, future.cancel
+    assert_raises(CassandraC::Error) { future.wait }
+    assert_raises(CassandraC::Error) { future.get_result }
+    assert_raises(CassandraC::Error) { future.on_complete {} }
+  end
+
+  def test_cancel_propagates_to_chained_futures
+    future = session.prepare(QUERY, async: true)
+    chained = future.then_execute(session)
+    future.cancel
+
+    error = assert_raises(CassandraC::Error) { chained.get_result }
+    assert_match(/cancelled/, error.message)
+  end
+
+  def test_wait_all_rejects_negative_timeout
+    future = session.execute(QUERY, async: true)
+    assert_raises(ArgumentError) { CassandraC::Native::Future.wait_all([future], timeout: -1) }
+    future.wait
+  end
+end
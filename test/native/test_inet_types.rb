@@ -113,6 +113,15 @@ class TestInetTypes < Minitest::Test
     assert_includes error.message, "Failed to bind inet parameter"
   end
 
+  def test_unparsable_text_of_address_length_is_rejected
+    statement = session.prepare("INSERT INTO cassandra_c_test.inet_types (id, ip_address) VALUES (?, ?)").bind
+
+    ["abcd", "not-an-address!!"].each do |text|
+      assert_raises(CassandraC::Error) { statement.bind_inet_by_index(1, text) }
+    end
+    statement.bind_inet_by_index(1, [10, 0, 0, 1].pack("C*"))
+  end
+
   def test_localhost_addresses
     prepared = session.prepare("INSERT INTO cassandra_c_test.inet_types (id, ip_address, server_ip) VALUES (?, ?, ?)")
     statement = prepared.bind
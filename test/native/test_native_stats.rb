@@ -0,0 +1,78 @@
+# frozen_string_literal: true
+
+require "test_helper"
+require "objspace"
+
+class TestNativeStats < Minitest::Test
+  QUERY = "SELECT keyspace_name FROM system_schema.keyspaces"
+
+  def test_stats_reports_live_handles
+    stats = CassandraC::Native.stats
+
+    %i[statements futures results prepared batches result_bytes].each do |key|
+      assert_kind_of Integer, stats[key]
+    end
+  end
+
+  def test_live_handles_are_counted
+    GC.disable
+    before = CassandraC::Native.stats
+    statement = CassandraC::Native::Statement.new(QUERY)
+    future = session.execute(statement, async: true)
+    result = future.get_result
+    after = CassandraC::Native.stats
+
+    assert_operator after[:statements], :>=, before[:statements] + 1
+    assert_operator after[:futures], :>=, before[:futures] + 1
+    assert_operator after[:results], :>=, before[:results] + 1
+    assert_operator after[:result_bytes], :>, before[:result_bytes]
+    assert_kind_of CassandraC::Native::Result, result
+  ensure
+    GC.enable
+  end
+
+  def test_released_and_cancelled_futures_are_not_counted
+    GC.disable
+    released = session.execute(QUERY, async: true).wait
+    cancelled = session.execute(QUERY, async: true)
+    before = CassandraC::Native.stats[:futures]
+
+    released.release
+    cancelled.cancel
+    cancelled.cancel
+    cancelled.release
+
+    assert_equal before - 2, CassandraC::Native.stats[:futures]
+  ensure
+    GC.enable
+  end
+
+  def test_result_memsize_includes_row_data
+    data = Random.bytes(256 * 1024)
+    statement = session.prepare("INSERT INTO cassandra_c_test.test_blob_types (id, blob_data) VALUES (?, ?)").bind
+    statement.bind_text_by_index(0, "memsize")
+    statement.bind_blob_by_index(1, data)
+    session.execute(statement)
+
+    result = session.execute("SELECT blob_data FROM cassandra_c_test.test_blob_types WHERE id = 'memsize'")
+
+    assert_operator ObjectSpace.memsize_of(result), :>=, data.bytesize
+    assert_operator ObjectSpace.memsize_of(CassandraC::Native::Statement.new(QUERY)), :>, 0
+  end
+
+  def test_result_memsize_counts_every_row
+    data = Random.bytes(256 * 1024)
+    insert = session.prepare("INSERT INTO cassandra_c_test.test_blob_types (id, blob_data) VALUES (?, ?)")
+    session.execute(insert.bind(["memsize_null", nil]))
+    statement = insert.bind
+    statement.bind_text_by_index(0, "memsize_large")
+    statement.bind_blob_by_index(1, data)
+    session.execute(statement)
+
+    # Whichever row comes first, the large blob is counted
+    result = session.execute("SELECT blob_data FROM cassandra_c_test.test_blob_types WHERE id IN ('memsize_null', 'memsize_large')")
+
+    assert_equal 2, result.to_a.size
+    assert_operator ObjectSpace.memsize_of(result), :>=, data.bytesize
+  end
+end
@@ -0,0 +1,100 @@
+# frozen_string_literal: true
+
+require "test_helper"
+
+class TestPaging < Minitest::Test
+  QUERY = "SELECT keyspace_name FROM system_schema.keyspaces"
+
+  def keyspace_count
+    @keyspace_count ||= session.execute(QUERY).to_a.size
+  end
+
+  def test_each_page_yields_every_page
+    pages = session.each_page(QUERY, page_size: 2).to_a
+
+    assert_operator pages.size, :>, 1
+    pages.each { |page| assert_kind_of CassandraC::Native::Result, page }
+    assert_equal keyspace_count, pages.sum { |page| page.to_a.size }
+    refute pages.last.has_more_pages?
+  end
+
+  def test_each_across_pages_yields_every_row
+    statement = CassandraC::Native::Statement.new(QUERY)
+    statement.page_size = 2
+
+    rows = session.execute(statement).each_across_pages.to_a
+
+    assert_equal keyspace_count, rows.size
+    assert_equal session.execute(QUERY).to_a.sort, rows.sort
+  end
+
+  def test_statement_restarts_after_walk
+    statement = CassandraC::Native::Statement.new(QUERY)
+    statement.page_size = 2
+    session.each_page(statement) { |page| page }
+
+    assert_equal 2, session.execute(statement).to_a.size
+  end
+
+  def test_break_leaves_statement_reusable
+    statement = CassandraC::Native::Statement.new(QUERY)
+    statement.page_size = 2
+    5.times { session.each_page(statement) { |page| break page } }
+
+    assert_equal 2, session.execute(statement).to_a.size
+    assert_raises(RuntimeError) { session.each_page(statement) { raise "stop" } }
+    assert_equal 2, session.execute(statement).to_a.size
+  end
+
+  def test_each_page_size_applies_to_the_walk_only
+    statement = CassandraC::Native::Statement.new(QUERY)
+    statement.page_size = keyspace_count
+    assert_operator session.each_page(statement, page_size: 2).count, :>, 1
+
+    assert_equal keyspace_count, session.execute(statement).to_a.size
+  end
+
+  def test_string_query_result_cannot_fetch_more_pages
+    assert_equal keyspace_count, session.execute(QUERY).each_across_pages.to_a.size
+  end
+
+  def test_paging_state_resumes_on_a_new_statement
+    first = CassandraC::Native::Statement.new(QUERY)
+    first.page_size = 2
+    page = session.execute(first)
+    token = page.paging_state
+
+    assert_equal Encoding::BINARY, token.encoding
+    resumed = CassandraC::Native::Statement.new(QUERY)
+    resumed.page_size = keyspace_count
+    resumed.paging_state = token
+
+    rows = page.to_a + session.execute(resumed).to_a
+    assert_equal session.execute(QUERY).to_a.sort, rows.sort
+  end
+
+  def test_paging_state_is_nil_on_last_page
+    assert_nil session.execute(QUERY).paging_state
+    assert_nil session.execute(QUERY).paging_token
+  end
+
+  def test_paging_token_is_url_safe
+    statement = CassandraC::Native::Statement.new(QUERY)
+    statement.page_size = 2
+    page = session.execute(statement)
+    token = page.paging_token
+
+    assert_match(/\A[A-Za-z0-9_-]+\z/, token)
+    resumed = CassandraC::Native::Statement.new(QUERY)
+    resumed.page_size = 2
+    resumed.paging_token = token
+    refute_equal page.to_a, session.execute(resumed).to_a
+    assert_raises(ArgumentError) { resumed.paging_token = "a" }
+  end
+
+  def test_page_size_must_be_positive
+    statement = CassandraC::Native::Statement.new(QUERY)
+    assert_raises(ArgumentError) { statement.page_size = 0 }
+    statement.page_size = nil
+  end
+end
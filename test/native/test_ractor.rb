@@ -0,0 +1,53 @@
+# frozen_string_literal: true
+
+require "test_helper"
+
+class TestRactor < Minitest::Test
+  QUERY = "SELECT keyspace_name FROM system_schema.keyspaces"
+
+  def setup
+    @verbose, $VERBOSE = $VERBOSE, nil # Ractor is experimental and warns
+  end
+
+  def teardown
+    $VERBOSE = @verbose
+  end
+
+  def test_frozen_objects_are_shareable
+    assert Ractor.shareable?(cluster.freeze)
+    assert Ractor.shareable?(session.freeze)
+    assert Ractor.shareable?(session.prepare(QUERY).freeze)
+  end
+
+  def test_frozen_cluster_rejects_configuration
+    frozen = CassandraC::Native::Cluster.new.freeze
+    assert_raises(FrozenError) { frozen.port = 9042 }
+  end
+
+  def test_shared_session_executes_in_ractors
+    shared = Ractor.make_shareable(session)
+    prepared = Ractor.make_shareable(shared.prepare(QUERY))
+
+    ractors = Array.new(4) {
+      Ractor.new(shared, prepared) { |s, p|
+        rows = s.execute(p.bind).to_a
+        rows += s.execute("SELECT keyspace_name FROM system_schema.keyspaces").to_a
+        rows.size
+      }
+    }
+
+    ractors.each { |r| assert_operator r.take, :>, 0 }
+  end
+
+  def test_future_callbacks_in_ractor
+    shared = Ractor.make_shareable(session)
+
+    value = Ractor.new(shared) { |s|
+      queue = Thread::Queue.new
+      s.execute("SELECT keyspace_name FROM system_schema.keyspaces", async: true).on_complete { |result| queue << result.class.name }
+      queue.pop
+    }.take
+
+    assert_equal "CassandraC::Native::Result", value
+  end
+end
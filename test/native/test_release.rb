@@ -0,0 +1,97 @@
+# frozen_string_literal: true
+
+require "test_helper"
+
+class TestRelease < Minitest::Test
+  QUERY = "SELECT keyspace_name FROM system_schema.keyspaces"
+
+  def test_result_free
+    result = session.execute(QUERY)
+    rows = result.to_a
+
+    assert_nil result.free
+    assert result.freed?
+    assert_nil result.free
+    assert_raises(CassandraC::Error) { result.to_a }
+    assert_raises(CassandraC::Error) { result.row_count }
+    refute_empty rows
+  end
+
+  def test_result_free_while_iterating_raises
+    result = session.execute(QUERY)
+
+    assert_raises(CassandraC::Error) { result.each { result.free } }
+    refute result.freed?
+  end
+
+  def test_result_free_releases_rows_and_blob_views
+    skip "IO::Buffer requires Ruby 3.1+" if RUBY_VERSION < "3.1"
+    insert = session.prepare("INSERT INTO cassandra_c_test.test_blob_types (id, blob_data) VALUES (?, ?)").bind
+    insert.bind_text_by_index(0, "release_view")
+    insert.bind_blob_by_index(1, "payload")
+    session.execute(insert)
+
+    result = session.query("SELECT blob_data FROM cassandra_c_test.test_blob_types WHERE id = 'release_view'")
+    view = result.blob_view(0, 0)
+    row = result.each_row.first
+    result.free
+
+    assert_raises(RuntimeError) { view.get_string }
+    assert_raises(CassandraC::Error) { row[0] }
+  end
+
+  def test_statement_free
+    statement = CassandraC::Native::Statement.new(QUERY)
+
+    assert_nil statement.free
+    assert statement.freed?
+    assert_raises(CassandraC::Error) { statement.page_size = 10 }
+    assert_raises(CassandraC::Error) { session.execute(statement) }
+    assert_raises(CassandraC::Error) { CassandraC::Native::Batch.new(:logged).add(statement) }
+  end
+
+  def test_future_release
+    future = session.execute(QUERY, async: true)
+    result = future.get_result
+
+    assert_nil future.release
+    assert_nil future.release
+    assert_raises(CassandraC::Error) { future.get_result }
+    assert_raises(CassandraC::Error) { future.on_complete {} }
+    refute_empty result.to_a
+  end
+
+  def test_pending_future_cannot_be_released_until_cancelled
+    future = session.execute(QUERY, async: true)
+    begin
+      future.release
+    rescue CassandraC::Error
+      future.cancel
+      assert_nil future.release
+    end
+    assert_raises(CassandraC::Error) { future.get_result }
+  end
+
+  def test_execute_with_block_frees_result
+    kept = nil
+    count = session.execute(QUERY) { |result|
+      kept = result
+      result.to_a.size
+    }
+
+    assert_operator count, :>, 0
+    assert kept.freed?
+    assert_raises(ArgumentError) { session.execute(QUERY, async: true) {} }
+  end
+
+  def test_block_result_is_freed_when_block_raises
+    kept = nil
+    assert_raises(RuntimeError) {
+      session.query(QUERY) { |result|
+        kept = result
+        raise "boom"
+      }
+    }
+    assert kept.freed?
+  end
+end
@@ -0,0 +1,217 @@
+# frozen_string_literal: true
+
+require "test_helper"
+
+class TestResult < Minitest::Test
+  QUERY = "SELECT keyspace_name, durable_writes FROM system_schema.keyspaces"
+
+  def test_each_hash_yields_hashes
+    result = session.execute(QUERY)
+    hashes = result.each_hash.to_a
+
+    assert_equal result.to_a.map { |row| {"keyspace_name" => row[0], "durable_writes" => row[1]} }, hashes
+  end
+
+  def test_each_hash_keys_are_frozen_and_shared
+    hashes = session.execute(QUERY).each_hash.first(2)
+
+    key = hashes[0].keys.first
+    assert key.frozen?
+    assert_equal Encoding::UTF_8, key.encoding
+    assert_same key, hashes[1].keys.first
+  end
+
+  def test_column_names_match_for_prepared_and_unprepared
+    unprepared = session.execute(QUERY).column_names
+    prepared = session.execute(session.prepare(QUERY).bind).column_names
+
+    [unprepared, prepared].each do |names|
+      assert_equal ["keyspace_name", "durable_writes"], names
+      assert names.frozen?
+      assert names.all?(&:frozen?)
+      assert_equal [Encoding::UTF_8], names.map(&:encoding).uniq
+    end
+  end
+
+  def test_each_hash_with_symbol_keys
+    hash = session.execute(QUERY).each_hash(keys: :symbol).first
+    assert_equal [:keyspace_name, :durable_writes], hash.keys
+  end
+
+  def test_to_a_as_hash
+    result = session.execute(QUERY)
+
+    assert_equal result.each_hash.to_a, result.to_a(as: :hash)
+    assert_equal result.each_hash(keys: :symbol).to_a, result.to_a(as: :hash, keys: :symbol)
+    assert_equal result.each.to_a, result.to_a(as: :array)
+  end
+
+  def test_column_by_index_and_name
+    result = session.execute(QUERY)
+
+    assert_equal result.to_a.map(&:first), result.column(0)
+    assert_equal result.to_a.map(&:last), result.column("durable_writes")
+    assert_equal result.column(1), result.column(-1)
+    assert_raises(IndexError) { result.column(2) }
+    assert_raises(IndexError) { result.column("no_such_column") }
+  end
+
+  def test_packed_column
+    session.query("INSERT INTO cassandra_c_test.integer_types (id, int_val, big_val) VALUES (9001, 1, 10000000000)")
+    session.query("INSERT INTO cassandra_c_test.integer_types (id, int_val) VALUES (9002, -2)")
+    session.query("INSERT INTO cassandra_c_test.decimal_types (id, double_val, float_val) VALUES (9001, 1.5, 0.25)")
+
+    result = session.execute("SELECT int_val, big_val FROM cassandra_c_test.integer_types WHERE id IN (9001, 9002)")
+    data, nulls = result.packed_column("big_val")
+    assert_equal Encoding::BINARY, data.encoding
+    assert_equal [10_000_000_000, 0], data.unpack("q*")
+    assert_equal 0b10, nulls.unpack1("C")
+    assert_equal [[1, -2], "\x00".b], result.packed_column(:int_val).then { |d, n| [d.unpack("q*"), n] }
+
+    doubles = session.execute("SELECT double_val, float_val FROM cassandra_c_test.decimal_types WHERE id = 9001")
+    assert_equal [1.5], doubles.packed_column("double_val").first.unpack("d*")
+    assert_equal [0.25], doubles.packed_column("float_val").first.unpack("d*")
+  end
+
+  def test_packed_column_as_buffer
+    skip "IO::Buffer requires Ruby 3.1+" if RUBY_VERSION < "3.1"
+    session.query("INSERT INTO cassandra_c_test.integer_types (id, big_val) VALUES (9003, 42)")
+    result = session.execute("SELECT big_val FROM cassandra_c_test.integer_types WHERE id = 9003")
+
+    data, nulls = result.packed_column("big_val", as: :buffer)
+    assert_kind_of IO::Buffer, data
+    assert data.readonly?
+    assert_equal [42], data.get_string.unpack("q*")
+    assert_equal "\x00".b, nulls.get_string
+    assert_raises(ArgumentError) { result.packed_column("big_val", as: :array) }
+  end
+
+  def test_packed_column_rejects_non_numeric_columns
+    assert_raises(TypeError) { session.execute(QUERY).packed_column("keyspace_name") }
+  end
+
+  def test_prepared_results_share_metadata
+    prepared = session.prepare(QUERY)
+    assert_nil prepared.result_columns
+
+    first = session.execute(prepared.bind)
+    second = session.execute(prepared.bind, async: true).get_result
+
+    assert_same first.column_names, second.column_names
+    assert first.column_names.frozen?
+    assert_same first.each_hash.first.keys.first, second.each_hash.first.keys.first
+
+    columns = prepared.result_columns
+    assert columns.frozen?
+    assert_equal ["keyspace_name", "durable_writes"], columns.map { |column| column[:name] }
+    assert_includes [:text, :varchar], columns[0][:type]
+    assert_equal :boolean, columns[1][:type]
+  end
+
+  def test_result_columns_describe_collections
+    prepared = session.prepare("SELECT id, int_map FROM cassandra_c_test.map_types")
+    session.execute(prepared.bind)
+
+    int_map = prepared.result_columns.last
+    assert_equal :map, int_map[:type]
+    assert_equal 2, int_map[:subtypes].size
+    assert_equal :int, int_map[:subtypes].last
+  end
+
+  def test_binary_ids
+    uuid = "550e8400-e29b-41d4-a716-446655440000"
+    insert = CassandraC::Native::Statement.new("INSERT INTO cassandra_c_test.uuid_types (id, uuid_val) VALUES (?, ?)", 2)
+    insert.bind_by_index(0, "binary_ids")
+    insert.bind_by_index(1, uuid, :uuid)
+    session.execute(insert)
+    session.query("INSERT INTO cassandra_c_test.inet_types (id, ip_address, server_ip) VALUES ('binary_ids', '192.168.1.10', '::1')")
+
+    result = session.query("SELECT uuid_val FROM cassandra_c_test.uuid_types WHERE id = 'binary_ids'")
+    refute result.binary_ids?
+    result.binary_ids = true
+    bytes = result.to_a.first[0]
+
+    assert_equal 16, bytes.bytesize
+    assert_equal Encoding::BINARY, bytes.encoding
+    assert bytes.frozen?
+    assert_equal uuid, CassandraC::Native.format_uuid(bytes)
+
+    # The binary form binds back to a uuid column
+    insert.bind_by_index(0, "binary_ids_copy")
+    insert.bind_by_index(1, bytes, :uuid)
+    session.execute(insert)
+    copy = session.query("SELECT uuid_val FROM cassandra_c_test.uuid_types WHERE id = 'binary_ids_copy'")
+    assert_equal [[uuid]], copy.to_a
+
+    inet = session.query("SELECT ip_address, server_ip FROM cassandra_c_test.inet_types WHERE id = 'binary_ids'")
+    inet.binary_ids = true
+    assert_equal [[[192, 168, 1, 10].pack("C*"), ([0] * 15 + [1]).pack("C*")]], inet.to_a
+  end
+
+  def test_format_uuid_rejects_wrong_size
+    assert_raises(ArgumentError) { CassandraC::Native.format_uuid("short") }
+  end
+
+  def test_intern_columns
+    first = session.execute(QUERY)
+    second = session.execute(QUERY)
+    first.intern_columns = ["keyspace_name"]
+    second.intern_columns = true
+
+    names = first.column(0)
+    assert names.all?(&:frozen?)
+    assert_equal Encoding::UTF_8, names.first.encoding
+    assert_same names.first, second.column(0).first
+    assert_same names.first, -names.first.dup
+
+    first.intern_columns = nil
+    refute first.column(0).first.frozen?
+  end
+
+  def test_intern_columns_rejects_non_text_columns
+    result = session.execute(QUERY)
+    assert_raises(ArgumentError) { result.intern_columns = [:durable_writes] }
+    assert_raises(IndexError) { result.intern_columns = ["missing"] }
+    assert_raises(TypeError) { result.intern_columns = "keyspace_name" }
+  end
+
+  def test_blob_views
+    skip "IO::Buffer requires Ruby 3.1+" if RUBY_VERSION < "3.1"
+    data = Random.new(1).bytes(200_000)
+    insert = session.prepare("INSERT INTO cassandra_c_test.test_blob_types (id, blob_data) VALUES (?, ?)").bind
+    insert.bind_text_by_index(0, "blob_view")
+    insert.bind_blob_by_index(1, data)
+    session.execute(insert)
+
+    result = session.query("SELECT id, blob_data FROM cassandra_c_test.test_blob_types WHERE id = 'blob_view'")
+    view = result.blob_view(0, "blob_data")
+
+    assert_kind_of IO::Buffer, view
+    assert view.readonly?
+    assert_equal data, view.get_string
+    assert_raises(TypeError) { result.blob_view(0, "id") }
+
+    result.blobs = :buffer
+    assert_equal :buffer, result.blobs
+    assert_equal data, result.to_a.first[1].get_string
+  end
+
+  def test_blob_views_keep_result_alive
+    skip "IO::Buffer requires Ruby 3.1+" if RUBY_VERSION < "3.1"
+    insert = session.prepare("INSERT INTO cassandra_c_test.test_blob_types (id, blob_data) VALUES (?, ?)").bind
+    insert.bind_text_by_index(0, "blob_view_gc")
+    insert.bind_blob_by_index(1, "payload")
+    session.execute(insert)
+
+    view = session.query("SELECT blob_data FROM cassandra_c_test.test_blob_types WHERE id = 'blob_view_gc'").blob_view(0, 0)
+    GC.start
+    assert_equal "payload", view.get_string
+  end
+
+  def test_rejects_invalid_options
+    result = session.execute(QUERY)
+    assert_raises(ArgumentError) { result.to_a(as: :set) }
+    assert_raises(ArgumentError) { result.each_hash(keys: :other) {} }
+    assert_raises(ArgumentError) { result.blobs = :other }
+  end
+end
@@ -0,0 +1,56 @@
+# frozen_string_literal: true
+
+require "test_helper"
+
+class TestRow < Minitest::Test
+  QUERY = "SELECT keyspace_name, durable_writes FROM system_schema.keyspaces"
+
+  def test_each_row_matches_each
+    result = session.execute(QUERY)
+    rows = result.each_row.map(&:to_a)
+
+    assert_equal result.to_a, rows
+  end
+
+  def test_access_by_index_and_name
+    result = session.execute(QUERY)
+    result.each_row do |row|
+      assert_kind_of CassandraC::Native::Row, row
+      assert_equal 2, row.size
+      assert_equal row[0], row["keyspace_name"]
+      assert_equal row[1], row[:durable_writes]
+      assert_equal row[1], row[-1]
+      assert_nil row[2]
+      assert_nil row["no_such_column"]
+    end
+  end
+
+  def test_values_are_memoized
+    result = session.execute(QUERY)
+    row = result.each_row.first
+
+    assert_same row[0], row[0]
+  end
+
+  def test_retained_rows_decode_after_iteration
+    result = session.execute(QUERY)
+    expected = result.to_a
+    rows = result.each_row.to_a
+
+    assert_equal expected.map(&:last).reverse, rows.reverse.map { |row| row[1] }
+    assert_equal expected.map(&:first), rows.map { |row| row["keyspace_name"] }
+  end
+
+  def test_rows_read_in_random_order
+    result = session.execute(QUERY)
+    expected = result.to_a
+    rows = result.each_row.to_a
+
+    order = (0...rows.size).to_a.shuffle(random: Random.new(42))
+    order.each { |i| assert_equal expected[i], rows[i].to_a }
+  end
+
+  def test_rows_cannot_be_instantiated
+    assert_raises(TypeError, NoMethodError) { CassandraC::Native::Row.new }
+  end
+end
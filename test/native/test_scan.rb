@@ -0,0 +1,66 @@
+# frozen_string_literal: true
+
+require "test_helper"
+require "tmpdir"
+
+class TestScan < Minitest::Test
+  KEYSPACE = "cassandra_c_test"
+  TABLE = "test_bind_params"
+
+  def setup
+    prepared = session.prepare("INSERT INTO #{KEYSPACE}.#{TABLE} (keyspace_name, id) VALUES (?, ?)")
+    session.execute_concurrent(prepared, Array.new(50) { |i| ["scan_#{i}", i.to_s] })
+  end
+
+  def all_rows
+    session.execute("SELECT keyspace_name, id FROM #{KEYSPACE}.#{TABLE}").to_a
+  end
+
+  def test_scan_yields_every_row_once
+    rows = session.scan(KEYSPACE, TABLE, columns: %w[keyspace_name id], splits: 16, concurrency: 4, page_size: 5).to_a
+
+    assert_equal all_rows.sort, rows.sort
+  end
+
+  def test_scan_yields_pages
+    pages = session.scan(KEYSPACE, TABLE, splits: 4, page_size: 5, pages: true).to_a
+
+    pages.each { |page| assert_kind_of CassandraC::Native::Result, page }
+    assert_equal all_rows.size, pages.sum { |page| page.to_a.size }
+  end
+
+  def test_ranges_cover_the_ring
+    scan = CassandraC::Native::TokenRangeScan.new(session, KEYSPACE, TABLE, splits: 3)
+
+    assert_equal CassandraC::Native::TokenRangeScan::MIN_TOKEN, scan.range(0).first
+    assert_equal CassandraC::Native::TokenRangeScan::MAX_TOKEN, scan.range(2).last
+    assert_equal scan.range(0).last, scan.range(1).first
+  end
+
+  def test_checkpoint_skips_completed_ranges
+    Dir.mktmpdir do |dir|
+      checkpoint = File.join(dir, "scan.checkpoint")
+      # One range at a time, so ranges 0-2 complete before the fourth page
+      completed = []
+      assert_raises(RuntimeError) {
+        session.scan(KEYSPACE, TABLE, splits: 8, concurrency: 1, pages: true, checkpoint: checkpoint) { |page|
+          raise "interrupted" if completed.size == 3
+          completed << page.to_a
+        }
+      }
+      assert_equal "splits 8\n0\n1\n2\n", File.read(checkpoint)
+
+      resumed = session.scan(KEYSPACE, TABLE, splits: 8, checkpoint: checkpoint).to_a
+      session.scan(KEYSPACE, TABLE, splits: 8, checkpoint: checkpoint) { flunk "every range was completed" }
+
+      assert_equal all_rows.sort, (completed.flatten(1) + resumed).sort
+      assert_raises(ArgumentError) { session.scan(KEYSPACE, TABLE, splits: 4, checkpoint: checkpoint) {} }
+    end
+  end
+
+  def test_rejects_invalid_arguments
+    assert_raises(ArgumentError) { session.scan(KEYSPACE, TABLE, splits: 0) {} }
+    assert_raises(ArgumentError) { session.scan(KEYSPACE, TABLE, concurrency: 0) {} }
+    assert_raises(ArgumentError) { session.scan(KEYSPACE, "no_such_table") {} }
+  end
+end
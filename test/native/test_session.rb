@@ -83,4 +83,128 @@ class TestSession < Minitest::Test
     statement4 = prepared3.bind(["test4", 3.14])
     assert_kind_of CassandraC::Native::Statement, statement4
   end
+
+  def test_in_flight_is_counted
+    test_session = CassandraC::Native::Session.new
+    test_session.connect(cluster)
+    assert_equal 0, test_session.in_flight
+
+    futures = Array.new(5) { test_session.execute("SELECT * FROM system.local", async: true) }
+    assert_operator test_session.in_flight, :<=, 5
+    futures.each(&:wait)
+    sleep 0.01 until test_session.in_flight.zero?
+
+    assert_equal 0, test_session.in_flight
+    test_session.close
+  end
+
+  def test_max_in_flight_limits_requests
+    test_session = CassandraC::Native::Session.new
+    test_session.connect(cluster)
+    assert_nil test_session.max_in_flight
+    test_session.max_in_flight = 2
+    assert_equal 2, test_session.max_in_flight
+
+    futures = Array.new(10) { test_session.execute("SELECT * FROM system.local", async: true) }
+    assert_operator test_session.in_flight, :<=, 2
+    futures.each { |future| assert_kind_of CassandraC::Native::Result, future.wait.get_result }
+
+    test_session.max_in_flight = nil
+    assert_nil test_session.max_in_flight
+    test_session.close
+  end
+
+  def test_try_execute_returns_busy_at_limit
+    test_session = CassandraC::Native::Session.new
+    test_session.connect(cluster)
+    test_session.max_in_flight = 1
+
+    results = Array.new(20) { test_session.try_execute("SELECT * FROM system.local", async: true) }
+
+    assert_kind_of CassandraC::Native::Future, results.first
+    assert_includes results, :busy
+    results.grep(CassandraC::Native::Future).each(&:wait)
+    test_session.close
+  end
+
+  def test_max_in_flight_rejects_negative
+    assert_raises(ArgumentError) { session.max_in_flight = -1 }
+  end
+
+  def test_execute_within_deadline
+    result = session.execute("SELECT * FROM system.local", deadline: 5)
+    assert_kind_of CassandraC::Native::Result, result
+
+    batch = CassandraC::Native::Batch.new(:logged)
+    batch.add(CassandraC::Native::Statement.new("INSERT INTO cassandra_c_test.test_bind_params (keyspace_name, id) VALUES ('deadline', 'deadline')"))
+    assert_kind_of CassandraC::Native::Result, session.execute_batch(batch, deadline: 5)
+  end
+
+  def test_execute_past_deadline_raises
+    error = assert_raises(CassandraC::Error) { session.execute("SELECT * FROM system.local", deadline: 0.000001) }
+    assert_match(/deadline exceeded/, error.message)
+    sleep 0.01 until session.in_flight.zero?
+  end
+
+  def test_deadline_under_scheduler_releases_slot
+    skip "Fiber scheduler C API requires Ruby 3.1+" if RUBY_VERSION < "3.1"
+    test_session = CassandraC::Native::Session.new
+    test_session.connect(cluster)
+    test_session.max_in_flight = 1
+
+    error = Thread.new {
+      Fiber.set_scheduler(RecordingScheduler.new)
+      raised = nil
+      Fiber.schedule {
+        begin
+          test_session.execute("SELECT * FROM system.local", deadline: 0.000001)
+        rescue CassandraC::Error => e
+          raised = e
+        end
+      }
+      Fiber.scheduler.run
+      raised
+    }.value
+    assert_match(/deadline exceeded/, error.message)
+
+    3.times { assert_kind_of CassandraC::Native::Result, test_session.execute("SELECT * FROM system.local", deadline: 5) }
+    test_session.close
+  end
+
+  def test_interrupted_execute_releases_slot_on_completion
+    test_session = CassandraC::Native::Session.new
+    test_session.connect(cluster)
+    test_session.max_in_flight = 1
+
+    thread = Thread.new { test_session.execute("SELECT * FROM system_schema.columns") }
+    sleep 0.001 until test_session.in_flight == 1 || !thread.alive?
+    thread.kill
+    thread.join
+
+    # The abandoned request holds its slot until the driver completes it
+    sleep 0.01 until test_session.in_flight.zero?
+    assert_kind_of CassandraC::Native::Result, test_session.execute("SELECT * FROM system.local", deadline: 5)
+    test_session.close
+  end
+
+  def test_deadline_does_not_stay_on_statement
+    statement = CassandraC::Native::Statement.new("SELECT * FROM system.local")
+    assert_raises(CassandraC::Error) { session.execute(statement, deadline: 0.000001) }
+    sleep 0.01 until session.in_flight.zero?
+
+    5.times { assert_kind_of CassandraC::Native::Result, session.execute(statement) }
+  end
+
+  def test_async_wait_returns_at_deadline
+    future = session.execute("SELECT * FROM system.local", async: true, deadline: 0.000001)
+
+    started = Process.clock_gettime(Process::CLOCK_MONOTONIC)
+    assert_same future, future.wait
+    assert_operator Process.clock_gettime(Process::CLOCK_MONOTONIC) - started, :<, 1
+    assert_raises(CassandraC::Error) { future.get_result }
+  end
+
+  def test_deadline_must_be_positive
+    assert_raises(ArgumentError) { session.execute("SELECT * FROM system.local", deadline: 0) }
+  end
 end
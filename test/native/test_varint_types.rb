@@ -76,4 +76,27 @@ class TestVarintTypes < Minitest::Test
     assert retrieved == huge_number
     assert_instance_of Integer, retrieved
   end
+
+  def test_varint_byte_boundaries
+    statement = CassandraC::Native::Statement.new("INSERT INTO cassandra_c_test.integer_types (id, var_val) VALUES (?, ?)", 2)
+    values = [0, 1, -1, 127, 128, -128, -129, 255, 256, 2**63, -(2**63), 2**64]
+
+    values.each_with_index do |value, i|
+      statement.bind_by_index(0, 50 + i, :int)
+      statement.bind_by_index(1, value, :varint)
+      session.execute(statement)
+    end
+
+    values.each_with_index do |value, i|
+      result = session.query("SELECT var_val FROM cassandra_c_test.integer_types WHERE id = #{50 + i}")
+      assert_equal value, result.to_a.first[0]
+    end
+  end
+
+  def test_varint_matches_cql_literals
+    session.query("INSERT INTO cassandra_c_test.integer_types (id, var_val) VALUES (46, -98765432109876543210)")
+
+    result = session.query("SELECT var_val FROM cassandra_c_test.integer_types WHERE id = 46")
+    assert_equal(-98765432109876543210, result.to_a.first[0])
+  end
 end
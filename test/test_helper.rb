@@ -88,6 +88,67 @@ module TestHelpers
   end
 end
 
+# Minimal Fiber scheduler that records io_wait calls. A fiber waiting on IO is
+# parked until #run (or #close) finds the IO readable or its timeout passed,
+# so other fibers run in the meantime.
+class RecordingScheduler
+  attr_reader :io_waits
+
+  def initialize
+    @io_waits = 0
+    @waiting = {}
+  end
+
+  def io_wait(io, events, timeout)
+    @io_waits += 1
+    deadline = timeout && now + timeout
+    @waiting[Fiber.current] = [io, events, deadline]
+    Fiber.yield
+  end
+
+  def fiber(&block)
+    Fiber.new(blocking: false, &block).tap(&:resume)
+  end
+
+  # Resume parked fibers until none are left
+  def run
+    until @waiting.empty?
+      deadlines = @waiting.values.filter_map(&:last)
+      timeout = deadlines.empty? ? nil : [deadlines.min - now, 0].max
+      readable, = IO.select(@waiting.values.map(&:first), nil, nil, timeout)
+
+      @waiting.to_a.each do |fiber, (io, events, deadline)|
+        if readable&.include?(io)
+          @waiting.delete(fiber)
+          fiber.resume(events)
+        elsif deadline && deadline <= now
+          @waiting.delete(fiber)
+          fiber.resume(false)
+        end
+      end
+    end
+  end
+
+  def kernel_sleep(duration = nil)
+  end
+
+  def block(blocker, timeout = nil)
+  end
+
+  def unblock(blocker, fiber)
+  end
+
+  def close
+    run
+  end
+
+  private
+
+  def now
+    Process.clock_gettime(Process::CLOCK_MONOTONIC)
+  end
+end
+
 # Include helpers in all test classes
 class Minitest::Test
   include TestHelpers